@@ -0,0 +1,99 @@
+/**
+ * @file LockBench.cpp
+ * @author DM8AT
+ * @brief a benchmark of the mutex, the shared mutex and the sequence lock at different read:write ratios
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the locks to measure
+#include "../CBinding/Mutex.h"
+#include "../CBinding/SharedMutex.h"
+#include "../CBinding/SeqLock.h"
+
+//printing stuff
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief the snapshot all locks protect, a typical small block of read-mostly state
+ */
+struct BenchState
+{
+    uint64_t values[4];
+};
+
+/**
+ * @brief run a benchmark on multiple threads. Every thread writes once per ratio reads.
+ * 
+ * @tparam R the type of the read function
+ * @tparam W the type of the write function
+ * @param threads the amount of threads
+ * @param ops the amount of operations per thread
+ * @param ratio the amount of reads per write
+ * @param read the function to read the state
+ * @param write the function to write the state
+ * @return double the amount of million operations per second over all threads
+ */
+template <typename R, typename W>
+static double __bench(uint32_t threads, uint64_t ops, uint64_t ratio, R read, W write)
+{
+    std::vector<std::thread> workers;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([=]() {
+            //the sum keeps the reads from being optimized away
+            uint64_t sum = 0;
+            for (uint64_t i = 0; i < ops; ++i)
+            {
+                if ((i + t) % (ratio + 1) == 0) {write(i);}
+                else {sum += read();}
+            }
+            if (sum == 1) {printf(" ");}
+        });
+    }
+    for (std::thread& worker : workers) {worker.join();}
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return (double)(ops * threads) / seconds / 1e6;
+}
+
+int main(int argc, char** argv)
+{
+    //the thread count and the operations per thread can be overwritten
+    uint32_t threads = (argc > 1) ? (uint32_t)atoi(argv[1]) : std::thread::hardware_concurrency();
+    uint64_t ops = (argc > 2) ? (uint64_t)atoll(argv[2]) : 2000000;
+    threads = (threads == 0) ? 1 : threads;
+
+    printf("%u threads, %llu operations per thread, million operations per second\n", threads, (unsigned long long)ops);
+    printf("%-12s %12s %12s %12s\n", "reads:write", "Mutex", "SharedMutex", "SeqLock");
+
+    const uint64_t ratios[] = {100, 1000, 10000};
+    for (uint64_t ratio : ratios)
+    {
+        BenchState state{};
+        Mutex mutex;
+        double mutexRate = __bench(threads, ops, ratio,
+            [&]() {mutex.lock(); uint64_t v = state.values[0] + state.values[3]; mutex.unlock(); return v;},
+            [&](uint64_t i) {mutex.lock(); state.values[0] = i; state.values[3] = i; mutex.unlock();});
+
+        SharedMutex shared;
+        double sharedRate = __bench(threads, ops, ratio,
+            [&]() {shared.lock_shared(); uint64_t v = state.values[0] + state.values[3]; shared.unlock_shared(); return v;},
+            [&](uint64_t i) {shared.lock(); state.values[0] = i; state.values[3] = i; shared.unlock();});
+
+        SeqLock seq(sizeof(BenchState));
+        double seqRate = __bench(threads, ops, ratio,
+            [&]() {BenchState s; seq.load(s); return s.values[0] + s.values[3];},
+            [&](uint64_t i) {BenchState s{{i, 0, 0, i}}; seq.store(s);});
+
+        printf("%-12llu %12.2f %12.2f %12.2f\n", (unsigned long long)ratio, mutexRate, sharedRate, seqRate);
+    }
+    return 0;
+}
@@ -0,0 +1,159 @@
+/**
+ * @file QueueBench.cpp
+ * @author DM8AT
+ * @brief a benchmark of the throughput and latency of the lock-free queues
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the queues to measure
+#include "../Threading/SPSCQueue.h"
+#include "../Threading/MPMCQueue.h"
+
+//printing stuff
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <vector>
+
+/**
+ * @brief the amount of elements per batch in the batched runs
+ */
+#define GLGE_BENCH_BATCH 64
+
+/**
+ * @brief the capacity of the measured queues
+ */
+#define GLGE_BENCH_CAPACITY 1024
+
+/**
+ * @brief move elements from producers to consumers and measure the throughput
+ * 
+ * @tparam Q the type of the queue
+ * @param queue the queue to move the elements through
+ * @param producers the amount of producing threads
+ * @param consumers the amount of consuming threads
+ * @param ops the amount of elements each producer pushes
+ * @param batch the amount of elements per push and pop
+ * @return double the amount of million elements per second
+ */
+template <typename Q>
+static double __throughput(Q& queue, uint32_t producers, uint32_t consumers, uint64_t ops, uint64_t batch)
+{
+    uint64_t total = ops * producers;
+    std::atomic<uint64_t> popped{0};
+    std::vector<std::thread> threads;
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&]() {
+            uint64_t values[GLGE_BENCH_BATCH];
+            for (uint64_t i = 0; i < ops;)
+            {
+                uint64_t count = ((ops - i) < batch) ? (ops - i) : batch;
+                for (uint64_t j = 0; j < count; ++j) {values[j] = i + j;}
+                uint64_t pushed = (count == 1) ? (uint64_t)queue.push(values) : queue.pushBatch(values, count);
+                if (pushed == 0) {std::this_thread::yield();}
+                i += pushed;
+            }
+        });
+    }
+    for (uint32_t c = 0; c < consumers; ++c)
+    {
+        threads.emplace_back([&]() {
+            uint64_t values[GLGE_BENCH_BATCH];
+            while (popped.load(std::memory_order_relaxed) < total)
+            {
+                uint64_t count = (batch == 1) ? (uint64_t)queue.pop(values) : queue.popBatch(values, batch);
+                if (count == 0) {std::this_thread::yield(); continue;}
+                popped.fetch_add(count, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {thread.join();}
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return (double)total / seconds / 1e6;
+}
+
+/**
+ * @brief bounce a single element between two threads and measure the one-way latency
+ * 
+ * @tparam Q the type of the queues
+ * @param ping the queue from the first to the second thread
+ * @param pong the queue from the second to the first thread
+ * @param rounds the amount of round trips
+ * @return double the average one-way latency in nanoseconds
+ */
+template <typename Q>
+static double __latency(Q& ping, Q& pong, uint64_t rounds)
+{
+    std::thread echo([&]() {
+        uint64_t value;
+        for (uint64_t i = 0; i < rounds; ++i)
+        {
+            while (!ping.pop(&value)) {std::this_thread::yield();}
+            while (!pong.push(&value)) {std::this_thread::yield();}
+        }
+    });
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < rounds; ++i)
+    {
+        uint64_t value = i;
+        while (!ping.push(&value)) {std::this_thread::yield();}
+        while (!pong.pop(&value)) {std::this_thread::yield();}
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    echo.join();
+    return ns / (double)(2 * rounds);
+}
+
+int main(int argc, char** argv)
+{
+    //the thread count and the elements per producer can be overwritten
+    uint32_t threads = (argc > 1) ? (uint32_t)atoi(argv[1]) : std::thread::hardware_concurrency();
+    uint64_t ops = (argc > 2) ? (uint64_t)atoll(argv[2]) : 2000000;
+    uint32_t half = (threads < 2) ? 1 : threads / 2;
+    uint64_t rounds = (ops < 100000) ? ops : 100000;
+
+    printf("%llu elements per producer, million elements per second\n", (unsigned long long)ops);
+    printf("%-28s %12s %12s\n", "queue", "single", "batched");
+    {
+        SPSCQueue queue(sizeof(uint64_t), GLGE_BENCH_CAPACITY);
+        double single = __throughput(queue, 1, 1, ops, 1);
+        double batched = __throughput(queue, 1, 1, ops, GLGE_BENCH_BATCH);
+        printf("%-28s %12.2f %12.2f\n", "SPSC 1:1", single, batched);
+    }
+    {
+        MPMCQueue queue(sizeof(uint64_t), GLGE_BENCH_CAPACITY);
+        double single = __throughput(queue, 1, 1, ops, 1);
+        double batched = __throughput(queue, 1, 1, ops, GLGE_BENCH_BATCH);
+        printf("%-28s %12.2f %12.2f\n", "MPMC 1:1", single, batched);
+    }
+    {
+        MPMCQueue queue(sizeof(uint64_t), GLGE_BENCH_CAPACITY);
+        double single = __throughput(queue, half, half, ops, 1);
+        double batched = __throughput(queue, half, half, ops, GLGE_BENCH_BATCH);
+        char name[32];
+        snprintf(name, sizeof(name), "MPMC %u:%u", half, half);
+        printf("%-28s %12.2f %12.2f\n", name, single, batched);
+    }
+
+    printf("\n%llu round trips, one-way latency in nanoseconds\n", (unsigned long long)rounds);
+    {
+        SPSCQueue ping(sizeof(uint64_t), GLGE_BENCH_CAPACITY), pong(sizeof(uint64_t), GLGE_BENCH_CAPACITY);
+        printf("%-28s %12.1f\n", "SPSC", __latency(ping, pong, rounds));
+    }
+    {
+        MPMCQueue ping(sizeof(uint64_t), GLGE_BENCH_CAPACITY), pong(sizeof(uint64_t), GLGE_BENCH_CAPACITY);
+        printf("%-28s %12.1f\n", "MPMC", __latency(ping, pong, rounds));
+    }
+    return 0;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file Atomic.cpp
+ * @author DM8AT
+ * @brief implement the atomics for compilers without the GCC atomic builtins
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include atomics
+#include "Atomic.h"
+
+//with GCC and clang everything is inlined in the header
+#if !GLGE_ATOMIC_INLINE
+
+//the C++ atomics operate on the plain values
+#include <atomic>
+
+/**
+ * @brief convert a memory order to a C++ memory order
+ * 
+ * @param order the memory order to convert
+ * @return std::memory_order the C++ memory order
+ */
+static std::memory_order __atomicOrder(AtomicMemoryOrder order)
+{
+    switch (order)
+    {
+    case GLGE_ATOMIC_RELAXED: return std::memory_order_relaxed;
+    case GLGE_ATOMIC_CONSUME: return std::memory_order_consume;
+    case GLGE_ATOMIC_ACQUIRE: return std::memory_order_acquire;
+    case GLGE_ATOMIC_RELEASE: return std::memory_order_release;
+    case GLGE_ATOMIC_ACQ_REL: return std::memory_order_acq_rel;
+    default: return std::memory_order_seq_cst;
+    }
+}
+
+/**
+ * @brief access the value of an atomic as a C++ atomic
+ * 
+ * @tparam T the type of the value
+ * @param value the value to access
+ * @return std::atomic_ref<T> the atomic reference
+ */
+template <typename T>
+static inline std::atomic_ref<T> __atomicRef(const T& value) {return std::atomic_ref<T>(const_cast<T&>(value));}
+
+extern "C" {
+
+uint32_t atomic32_Load(AtomicMemoryOrder order, const Atomic32* atomic) {return __atomicRef(atomic->value).load(__atomicOrder(order));}
+
+void atomic32_Store(uint32_t value, AtomicMemoryOrder order, Atomic32* atomic) {__atomicRef(atomic->value).store(value, __atomicOrder(order));}
+
+uint32_t atomic32_Exchange(uint32_t value, AtomicMemoryOrder order, Atomic32* atomic) {return __atomicRef(atomic->value).exchange(value, __atomicOrder(order));}
+
+bool atomic32_Compare_exchange_strong(uint32_t* expected, uint32_t desired, AtomicMemoryOrder success, AtomicMemoryOrder failure, Atomic32* atomic)
+{return __atomicRef(atomic->value).compare_exchange_strong(*expected, desired, __atomicOrder(success), __atomicOrder(failure));}
+
+bool atomic32_Compare_exchange_weak(uint32_t* expected, uint32_t desired, AtomicMemoryOrder success, AtomicMemoryOrder failure, Atomic32* atomic)
+{return __atomicRef(atomic->value).compare_exchange_weak(*expected, desired, __atomicOrder(success), __atomicOrder(failure));}
+
+uint32_t atomic32_Fetch_add(uint32_t value, AtomicMemoryOrder order, Atomic32* atomic) {return __atomicRef(atomic->value).fetch_add(value, __atomicOrder(order));}
+
+uint32_t atomic32_Fetch_sub(uint32_t value, AtomicMemoryOrder order, Atomic32* atomic) {return __atomicRef(atomic->value).fetch_sub(value, __atomicOrder(order));}
+
+uint32_t atomic32_Fetch_and(uint32_t value, AtomicMemoryOrder order, Atomic32* atomic) {return __atomicRef(atomic->value).fetch_and(value, __atomicOrder(order));}
+
+uint32_t atomic32_Fetch_or(uint32_t value, AtomicMemoryOrder order, Atomic32* atomic) {return __atomicRef(atomic->value).fetch_or(value, __atomicOrder(order));}
+
+uint64_t atomic64_Load(AtomicMemoryOrder order, const Atomic64* atomic) {return __atomicRef(atomic->value).load(__atomicOrder(order));}
+
+void atomic64_Store(uint64_t value, AtomicMemoryOrder order, Atomic64* atomic) {__atomicRef(atomic->value).store(value, __atomicOrder(order));}
+
+uint64_t atomic64_Exchange(uint64_t value, AtomicMemoryOrder order, Atomic64* atomic) {return __atomicRef(atomic->value).exchange(value, __atomicOrder(order));}
+
+bool atomic64_Compare_exchange_strong(uint64_t* expected, uint64_t desired, AtomicMemoryOrder success, AtomicMemoryOrder failure, Atomic64* atomic)
+{return __atomicRef(atomic->value).compare_exchange_strong(*expected, desired, __atomicOrder(success), __atomicOrder(failure));}
+
+bool atomic64_Compare_exchange_weak(uint64_t* expected, uint64_t desired, AtomicMemoryOrder success, AtomicMemoryOrder failure, Atomic64* atomic)
+{return __atomicRef(atomic->value).compare_exchange_weak(*expected, desired, __atomicOrder(success), __atomicOrder(failure));}
+
+uint64_t atomic64_Fetch_add(uint64_t value, AtomicMemoryOrder order, Atomic64* atomic) {return __atomicRef(atomic->value).fetch_add(value, __atomicOrder(order));}
+
+uint64_t atomic64_Fetch_sub(uint64_t value, AtomicMemoryOrder order, Atomic64* atomic) {return __atomicRef(atomic->value).fetch_sub(value, __atomicOrder(order));}
+
+uint64_t atomic64_Fetch_and(uint64_t value, AtomicMemoryOrder order, Atomic64* atomic) {return __atomicRef(atomic->value).fetch_and(value, __atomicOrder(order));}
+
+uint64_t atomic64_Fetch_or(uint64_t value, AtomicMemoryOrder order, Atomic64* atomic) {return __atomicRef(atomic->value).fetch_or(value, __atomicOrder(order));}
+
+void* atomicPtr_Load(AtomicMemoryOrder order, const AtomicPtr* atomic) {return __atomicRef(atomic->value).load(__atomicOrder(order));}
+
+void atomicPtr_Store(void* value, AtomicMemoryOrder order, AtomicPtr* atomic) {__atomicRef(atomic->value).store(value, __atomicOrder(order));}
+
+void* atomicPtr_Exchange(void* value, AtomicMemoryOrder order, AtomicPtr* atomic) {return __atomicRef(atomic->value).exchange(value, __atomicOrder(order));}
+
+bool atomicPtr_Compare_exchange_strong(void** expected, void* desired, AtomicMemoryOrder success, AtomicMemoryOrder failure, AtomicPtr* atomic)
+{return __atomicRef(atomic->value).compare_exchange_strong(*expected, desired, __atomicOrder(success), __atomicOrder(failure));}
+
+bool atomicPtr_Compare_exchange_weak(void** expected, void* desired, AtomicMemoryOrder success, AtomicMemoryOrder failure, AtomicPtr* atomic)
+{return __atomicRef(atomic->value).compare_exchange_weak(*expected, desired, __atomicOrder(success), __atomicOrder(failure));}
+
+void atomic_Thread_fence(AtomicMemoryOrder order) {std::atomic_thread_fence(__atomicOrder(order));}
+
+}
+
+#endif
@@ -0,0 +1,441 @@
+/**
+ * @file Atomic.h
+ * @author DM8AT
+ * @brief define atomic integers and pointers for C
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_C_ATOMIC_
+#define _GLGE_C_ATOMIC_
+
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+//GCC and clang provide atomic builtins that work in C and C++, so all functions are inlined there.
+//other compilers (MSVC) use the implementation in Atomic.cpp.
+#if defined(__GNUC__) || defined(__clang__)
+#define GLGE_ATOMIC_INLINE 1
+#define GLGE_ATOMIC_ALIGN(n) __attribute__((aligned(n)))
+#define GLGE_ATOMIC_FUNC static inline
+#else
+#define GLGE_ATOMIC_INLINE 0
+#define GLGE_ATOMIC_ALIGN(n) __declspec(align(n))
+#define GLGE_ATOMIC_FUNC
+#endif
+
+/**
+ * @brief initialize an atomic variable on declaration, e.g. Atomic32 counter = GLGE_ATOMIC_INIT(0);
+ */
+#define GLGE_ATOMIC_INIT(value) {(value)}
+
+/**
+ * @brief define the memory orders of atomic operations. They have the same meaning as the C++ memory orders.
+ */
+typedef enum e_AtomicMemoryOrder {
+    /**
+     * @brief only the operation itself is atomic, no ordering of other memory accesses
+     */
+    GLGE_ATOMIC_RELAXED = 0,
+    /**
+     * @brief like acquire, but only for data depending on the loaded value. Treated as acquire by all compilers.
+     */
+    GLGE_ATOMIC_CONSUME,
+    /**
+     * @brief no reads or writes after the operation can be moved before it
+     */
+    GLGE_ATOMIC_ACQUIRE,
+    /**
+     * @brief no reads or writes before the operation can be moved after it
+     */
+    GLGE_ATOMIC_RELEASE,
+    /**
+     * @brief acquire and release at once, for read-modify-write operations
+     */
+    GLGE_ATOMIC_ACQ_REL,
+    /**
+     * @brief acquire and release with a single total order of all sequentially consistent operations
+     */
+    GLGE_ATOMIC_SEQ_CST
+} AtomicMemoryOrder;
+
+/**
+ * @brief store an atomic 32 bit unsigned integer
+ */
+typedef struct s_Atomic32 {
+    /**
+     * @brief the value. Must only be accessed using the atomic32 functions.
+     */
+    GLGE_ATOMIC_ALIGN(4) uint32_t value;
+} Atomic32;
+
+/**
+ * @brief store an atomic 64 bit unsigned integer
+ */
+typedef struct s_Atomic64 {
+    /**
+     * @brief the value. Must only be accessed using the atomic64 functions. Aligned so it is lock free on 32 bit systems too.
+     */
+    GLGE_ATOMIC_ALIGN(8) uint64_t value;
+} Atomic64;
+
+/**
+ * @brief store an atomic pointer
+ */
+typedef struct s_AtomicPtr {
+    /**
+     * @brief the pointer. Must only be accessed using the atomicPtr functions.
+     */
+    void* value;
+} AtomicPtr;
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+//atomic 32 bit integer functions
+
+/**
+ * @brief read the value of an atomic 32 bit integer
+ * 
+ * @param order the memory order of the load. Must not be release or acq_rel.
+ * @param atomic a pointer to the atomic to read
+ * @return uint32_t the current value
+ */
+GLGE_ATOMIC_FUNC uint32_t atomic32_Load(AtomicMemoryOrder order, const Atomic32* atomic);
+
+/**
+ * @brief write the value of an atomic 32 bit integer
+ * 
+ * @param value the new value
+ * @param order the memory order of the store. Must be relaxed, release or seq_cst.
+ * @param atomic a pointer to the atomic to write
+ */
+GLGE_ATOMIC_FUNC void atomic32_Store(uint32_t value, AtomicMemoryOrder order, Atomic32* atomic);
+
+/**
+ * @brief replace the value of an atomic 32 bit integer
+ * 
+ * @param value the new value
+ * @param order the memory order of the exchange
+ * @param atomic a pointer to the atomic to change
+ * @return uint32_t the value before the exchange
+ */
+GLGE_ATOMIC_FUNC uint32_t atomic32_Exchange(uint32_t value, AtomicMemoryOrder order, Atomic32* atomic);
+
+/**
+ * @brief replace the value of an atomic 32 bit integer only if it matches an expected value.
+ * 
+ * @param expected a pointer to the expected value. On failure, it is filled with the current value.
+ * @param desired the value to store if the current value is the expected one
+ * @param success the memory order if the value was replaced
+ * @param failure the memory order if the value was not replaced. Must not be release or acq_rel and not stronger than success.
+ * @param atomic a pointer to the atomic to change
+ * @return true : the value was replaced
+ * @return false : the value did not match, expected was updated
+ */
+GLGE_ATOMIC_FUNC bool atomic32_Compare_exchange_strong(uint32_t* expected, uint32_t desired, AtomicMemoryOrder success, AtomicMemoryOrder failure, Atomic32* atomic);
+
+/**
+ * @brief replace the value of an atomic 32 bit integer only if it matches an expected value. May fail spuriously, so it should be used in a loop.
+ * 
+ * @param expected a pointer to the expected value. On failure, it is filled with the current value.
+ * @param desired the value to store if the current value is the expected one
+ * @param success the memory order if the value was replaced
+ * @param failure the memory order if the value was not replaced. Must not be release or acq_rel and not stronger than success.
+ * @param atomic a pointer to the atomic to change
+ * @return true : the value was replaced
+ * @return false : the value did not match, expected was updated
+ */
+GLGE_ATOMIC_FUNC bool atomic32_Compare_exchange_weak(uint32_t* expected, uint32_t desired, AtomicMemoryOrder success, AtomicMemoryOrder failure, Atomic32* atomic);
+
+/**
+ * @brief add a value to an atomic 32 bit integer
+ * 
+ * @param value the operand
+ * @param order the memory order of the operation
+ * @param atomic a pointer to the atomic to change
+ * @return uint32_t the value before the operation
+ */
+GLGE_ATOMIC_FUNC uint32_t atomic32_Fetch_add(uint32_t value, AtomicMemoryOrder order, Atomic32* atomic);
+
+/**
+ * @brief subtract a value from an atomic 32 bit integer
+ * 
+ * @param value the operand
+ * @param order the memory order of the operation
+ * @param atomic a pointer to the atomic to change
+ * @return uint32_t the value before the operation
+ */
+GLGE_ATOMIC_FUNC uint32_t atomic32_Fetch_sub(uint32_t value, AtomicMemoryOrder order, Atomic32* atomic);
+
+/**
+ * @brief apply a bitwise and with a value to an atomic 32 bit integer
+ * 
+ * @param value the operand
+ * @param order the memory order of the operation
+ * @param atomic a pointer to the atomic to change
+ * @return uint32_t the value before the operation
+ */
+GLGE_ATOMIC_FUNC uint32_t atomic32_Fetch_and(uint32_t value, AtomicMemoryOrder order, Atomic32* atomic);
+
+/**
+ * @brief apply a bitwise or with a value to an atomic 32 bit integer
+ * 
+ * @param value the operand
+ * @param order the memory order of the operation
+ * @param atomic a pointer to the atomic to change
+ * @return uint32_t the value before the operation
+ */
+GLGE_ATOMIC_FUNC uint32_t atomic32_Fetch_or(uint32_t value, AtomicMemoryOrder order, Atomic32* atomic);
+
+//atomic 64 bit integer functions
+
+/**
+ * @brief read the value of an atomic 64 bit integer
+ * 
+ * @param order the memory order of the load. Must not be release or acq_rel.
+ * @param atomic a pointer to the atomic to read
+ * @return uint64_t the current value
+ */
+GLGE_ATOMIC_FUNC uint64_t atomic64_Load(AtomicMemoryOrder order, const Atomic64* atomic);
+
+/**
+ * @brief write the value of an atomic 64 bit integer
+ * 
+ * @param value the new value
+ * @param order the memory order of the store. Must be relaxed, release or seq_cst.
+ * @param atomic a pointer to the atomic to write
+ */
+GLGE_ATOMIC_FUNC void atomic64_Store(uint64_t value, AtomicMemoryOrder order, Atomic64* atomic);
+
+/**
+ * @brief replace the value of an atomic 64 bit integer
+ * 
+ * @param value the new value
+ * @param order the memory order of the exchange
+ * @param atomic a pointer to the atomic to change
+ * @return uint64_t the value before the exchange
+ */
+GLGE_ATOMIC_FUNC uint64_t atomic64_Exchange(uint64_t value, AtomicMemoryOrder order, Atomic64* atomic);
+
+/**
+ * @brief replace the value of an atomic 64 bit integer only if it matches an expected value.
+ * 
+ * @param expected a pointer to the expected value. On failure, it is filled with the current value.
+ * @param desired the value to store if the current value is the expected one
+ * @param success the memory order if the value was replaced
+ * @param failure the memory order if the value was not replaced. Must not be release or acq_rel and not stronger than success.
+ * @param atomic a pointer to the atomic to change
+ * @return true : the value was replaced
+ * @return false : the value did not match, expected was updated
+ */
+GLGE_ATOMIC_FUNC bool atomic64_Compare_exchange_strong(uint64_t* expected, uint64_t desired, AtomicMemoryOrder success, AtomicMemoryOrder failure, Atomic64* atomic);
+
+/**
+ * @brief replace the value of an atomic 64 bit integer only if it matches an expected value. May fail spuriously, so it should be used in a loop.
+ * 
+ * @param expected a pointer to the expected value. On failure, it is filled with the current value.
+ * @param desired the value to store if the current value is the expected one
+ * @param success the memory order if the value was replaced
+ * @param failure the memory order if the value was not replaced. Must not be release or acq_rel and not stronger than success.
+ * @param atomic a pointer to the atomic to change
+ * @return true : the value was replaced
+ * @return false : the value did not match, expected was updated
+ */
+GLGE_ATOMIC_FUNC bool atomic64_Compare_exchange_weak(uint64_t* expected, uint64_t desired, AtomicMemoryOrder success, AtomicMemoryOrder failure, Atomic64* atomic);
+
+/**
+ * @brief add a value to an atomic 64 bit integer
+ * 
+ * @param value the operand
+ * @param order the memory order of the operation
+ * @param atomic a pointer to the atomic to change
+ * @return uint64_t the value before the operation
+ */
+GLGE_ATOMIC_FUNC uint64_t atomic64_Fetch_add(uint64_t value, AtomicMemoryOrder order, Atomic64* atomic);
+
+/**
+ * @brief subtract a value from an atomic 64 bit integer
+ * 
+ * @param value the operand
+ * @param order the memory order of the operation
+ * @param atomic a pointer to the atomic to change
+ * @return uint64_t the value before the operation
+ */
+GLGE_ATOMIC_FUNC uint64_t atomic64_Fetch_sub(uint64_t value, AtomicMemoryOrder order, Atomic64* atomic);
+
+/**
+ * @brief apply a bitwise and with a value to an atomic 64 bit integer
+ * 
+ * @param value the operand
+ * @param order the memory order of the operation
+ * @param atomic a pointer to the atomic to change
+ * @return uint64_t the value before the operation
+ */
+GLGE_ATOMIC_FUNC uint64_t atomic64_Fetch_and(uint64_t value, AtomicMemoryOrder order, Atomic64* atomic);
+
+/**
+ * @brief apply a bitwise or with a value to an atomic 64 bit integer
+ * 
+ * @param value the operand
+ * @param order the memory order of the operation
+ * @param atomic a pointer to the atomic to change
+ * @return uint64_t the value before the operation
+ */
+GLGE_ATOMIC_FUNC uint64_t atomic64_Fetch_or(uint64_t value, AtomicMemoryOrder order, Atomic64* atomic);
+
+//atomic pointer functions
+
+/**
+ * @brief read the value of an atomic pointer
+ * 
+ * @param order the memory order of the load. Must not be release or acq_rel.
+ * @param atomic a pointer to the atomic to read
+ * @return void* the current value
+ */
+GLGE_ATOMIC_FUNC void* atomicPtr_Load(AtomicMemoryOrder order, const AtomicPtr* atomic);
+
+/**
+ * @brief write the value of an atomic pointer
+ * 
+ * @param value the new value
+ * @param order the memory order of the store. Must be relaxed, release or seq_cst.
+ * @param atomic a pointer to the atomic to write
+ */
+GLGE_ATOMIC_FUNC void atomicPtr_Store(void* value, AtomicMemoryOrder order, AtomicPtr* atomic);
+
+/**
+ * @brief replace the value of an atomic pointer
+ * 
+ * @param value the new value
+ * @param order the memory order of the exchange
+ * @param atomic a pointer to the atomic to change
+ * @return void* the value before the exchange
+ */
+GLGE_ATOMIC_FUNC void* atomicPtr_Exchange(void* value, AtomicMemoryOrder order, AtomicPtr* atomic);
+
+/**
+ * @brief replace the value of an atomic pointer only if it matches an expected value.
+ * 
+ * @param expected a pointer to the expected value. On failure, it is filled with the current value.
+ * @param desired the value to store if the current value is the expected one
+ * @param success the memory order if the value was replaced
+ * @param failure the memory order if the value was not replaced. Must not be release or acq_rel and not stronger than success.
+ * @param atomic a pointer to the atomic to change
+ * @return true : the value was replaced
+ * @return false : the value did not match, expected was updated
+ */
+GLGE_ATOMIC_FUNC bool atomicPtr_Compare_exchange_strong(void** expected, void* desired, AtomicMemoryOrder success, AtomicMemoryOrder failure, AtomicPtr* atomic);
+
+/**
+ * @brief replace the value of an atomic pointer only if it matches an expected value. May fail spuriously, so it should be used in a loop.
+ * 
+ * @param expected a pointer to the expected value. On failure, it is filled with the current value.
+ * @param desired the value to store if the current value is the expected one
+ * @param success the memory order if the value was replaced
+ * @param failure the memory order if the value was not replaced. Must not be release or acq_rel and not stronger than success.
+ * @param atomic a pointer to the atomic to change
+ * @return true : the value was replaced
+ * @return false : the value did not match, expected was updated
+ */
+GLGE_ATOMIC_FUNC bool atomicPtr_Compare_exchange_weak(void** expected, void* desired, AtomicMemoryOrder success, AtomicMemoryOrder failure, AtomicPtr* atomic);
+
+/**
+ * @brief establish a memory ordering without an atomic operation
+ * 
+ * @param order the memory order of the fence
+ */
+GLGE_ATOMIC_FUNC void atomic_Thread_fence(AtomicMemoryOrder order);
+
+//inline implementation using the compiler builtins. The memory orders match the __ATOMIC_* constants.
+#if GLGE_ATOMIC_INLINE
+
+GLGE_ATOMIC_FUNC uint32_t atomic32_Load(AtomicMemoryOrder order, const Atomic32* atomic)
+{return __atomic_load_n(&atomic->value, (int)order);}
+
+GLGE_ATOMIC_FUNC void atomic32_Store(uint32_t value, AtomicMemoryOrder order, Atomic32* atomic)
+{__atomic_store_n(&atomic->value, value, (int)order);}
+
+GLGE_ATOMIC_FUNC uint32_t atomic32_Exchange(uint32_t value, AtomicMemoryOrder order, Atomic32* atomic)
+{return __atomic_exchange_n(&atomic->value, value, (int)order);}
+
+GLGE_ATOMIC_FUNC bool atomic32_Compare_exchange_strong(uint32_t* expected, uint32_t desired, AtomicMemoryOrder success, AtomicMemoryOrder failure, Atomic32* atomic)
+{return __atomic_compare_exchange_n(&atomic->value, expected, desired, false, (int)success, (int)failure);}
+
+GLGE_ATOMIC_FUNC bool atomic32_Compare_exchange_weak(uint32_t* expected, uint32_t desired, AtomicMemoryOrder success, AtomicMemoryOrder failure, Atomic32* atomic)
+{return __atomic_compare_exchange_n(&atomic->value, expected, desired, true, (int)success, (int)failure);}
+
+GLGE_ATOMIC_FUNC uint32_t atomic32_Fetch_add(uint32_t value, AtomicMemoryOrder order, Atomic32* atomic)
+{return __atomic_fetch_add(&atomic->value, value, (int)order);}
+
+GLGE_ATOMIC_FUNC uint32_t atomic32_Fetch_sub(uint32_t value, AtomicMemoryOrder order, Atomic32* atomic)
+{return __atomic_fetch_sub(&atomic->value, value, (int)order);}
+
+GLGE_ATOMIC_FUNC uint32_t atomic32_Fetch_and(uint32_t value, AtomicMemoryOrder order, Atomic32* atomic)
+{return __atomic_fetch_and(&atomic->value, value, (int)order);}
+
+GLGE_ATOMIC_FUNC uint32_t atomic32_Fetch_or(uint32_t value, AtomicMemoryOrder order, Atomic32* atomic)
+{return __atomic_fetch_or(&atomic->value, value, (int)order);}
+
+GLGE_ATOMIC_FUNC uint64_t atomic64_Load(AtomicMemoryOrder order, const Atomic64* atomic)
+{return __atomic_load_n(&atomic->value, (int)order);}
+
+GLGE_ATOMIC_FUNC void atomic64_Store(uint64_t value, AtomicMemoryOrder order, Atomic64* atomic)
+{__atomic_store_n(&atomic->value, value, (int)order);}
+
+GLGE_ATOMIC_FUNC uint64_t atomic64_Exchange(uint64_t value, AtomicMemoryOrder order, Atomic64* atomic)
+{return __atomic_exchange_n(&atomic->value, value, (int)order);}
+
+GLGE_ATOMIC_FUNC bool atomic64_Compare_exchange_strong(uint64_t* expected, uint64_t desired, AtomicMemoryOrder success, AtomicMemoryOrder failure, Atomic64* atomic)
+{return __atomic_compare_exchange_n(&atomic->value, expected, desired, false, (int)success, (int)failure);}
+
+GLGE_ATOMIC_FUNC bool atomic64_Compare_exchange_weak(uint64_t* expected, uint64_t desired, AtomicMemoryOrder success, AtomicMemoryOrder failure, Atomic64* atomic)
+{return __atomic_compare_exchange_n(&atomic->value, expected, desired, true, (int)success, (int)failure);}
+
+GLGE_ATOMIC_FUNC uint64_t atomic64_Fetch_add(uint64_t value, AtomicMemoryOrder order, Atomic64* atomic)
+{return __atomic_fetch_add(&atomic->value, value, (int)order);}
+
+GLGE_ATOMIC_FUNC uint64_t atomic64_Fetch_sub(uint64_t value, AtomicMemoryOrder order, Atomic64* atomic)
+{return __atomic_fetch_sub(&atomic->value, value, (int)order);}
+
+GLGE_ATOMIC_FUNC uint64_t atomic64_Fetch_and(uint64_t value, AtomicMemoryOrder order, Atomic64* atomic)
+{return __atomic_fetch_and(&atomic->value, value, (int)order);}
+
+GLGE_ATOMIC_FUNC uint64_t atomic64_Fetch_or(uint64_t value, AtomicMemoryOrder order, Atomic64* atomic)
+{return __atomic_fetch_or(&atomic->value, value, (int)order);}
+
+GLGE_ATOMIC_FUNC void* atomicPtr_Load(AtomicMemoryOrder order, const AtomicPtr* atomic)
+{return __atomic_load_n(&atomic->value, (int)order);}
+
+GLGE_ATOMIC_FUNC void atomicPtr_Store(void* value, AtomicMemoryOrder order, AtomicPtr* atomic)
+{__atomic_store_n(&atomic->value, value, (int)order);}
+
+GLGE_ATOMIC_FUNC void* atomicPtr_Exchange(void* value, AtomicMemoryOrder order, AtomicPtr* atomic)
+{return __atomic_exchange_n(&atomic->value, value, (int)order);}
+
+GLGE_ATOMIC_FUNC bool atomicPtr_Compare_exchange_strong(void** expected, void* desired, AtomicMemoryOrder success, AtomicMemoryOrder failure, AtomicPtr* atomic)
+{return __atomic_compare_exchange_n(&atomic->value, expected, desired, false, (int)success, (int)failure);}
+
+GLGE_ATOMIC_FUNC bool atomicPtr_Compare_exchange_weak(void** expected, void* desired, AtomicMemoryOrder success, AtomicMemoryOrder failure, AtomicPtr* atomic)
+{return __atomic_compare_exchange_n(&atomic->value, expected, desired, true, (int)success, (int)failure);}
+
+GLGE_ATOMIC_FUNC void atomic_Thread_fence(AtomicMemoryOrder order)
+{__atomic_thread_fence((int)order);}
+
+#endif
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+#endif
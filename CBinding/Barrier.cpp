@@ -0,0 +1,27 @@
+/**
+ * @file Barrier.cpp
+ * @author DM8AT
+ * @brief implement the C binding for the barrier structure
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the barrier
+#include "Barrier.h"
+
+extern "C" {
+
+Barrier* barrier_Create(int64_t count) {return new Barrier(count);}
+
+Barrier* barrier_CreateWithCompletion(int64_t count, void (*completion)(void*), void* data) {return new Barrier(count, completion, data);}
+
+void barrier_Destroy(Barrier* barrier) {delete barrier;}
+
+void barrier_Arrive_and_wait(Barrier* barrier) {barrier->arrive_and_wait();}
+
+void barrier_Arrive_and_drop(Barrier* barrier) {barrier->arrive_and_drop();}
+
+}
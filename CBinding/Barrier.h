@@ -0,0 +1,148 @@
+/**
+ * @file Barrier.h
+ * @author DM8AT
+ * @brief a C binding for a C++ barrier
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_C_BARRIER_
+#define _GLGE_C_BARRIER_
+
+//include the barrier from the default library for C++
+#if __cplusplus
+#include <barrier>
+#endif
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+//the completion function is only needed for C++
+#if __cplusplus
+
+/**
+ * @brief store the function that is called once per phase when all threads arrived at a barrier
+ */
+struct BarrierCompletion
+{
+    /**
+     * @brief the function to call or NULL
+     */
+    void (*func)(void*);
+    /**
+     * @brief the data to pass to the function
+     */
+    void* data;
+
+    /**
+     * @brief call the completion function if one is set
+     */
+    inline void operator()() noexcept {if (func) {(*func)(data);}}
+};
+
+#endif
+
+/**
+ * @brief store a barrier. A barrier blocks a fixed amount of threads till all of them arrived. It can be re-used for multiple phases.
+ */
+typedef struct s_Barrier {
+
+    //if this is C++, add a barrier in here
+    #if __cplusplus
+    std::barrier<BarrierCompletion> barrier;
+
+    //add the interface for the barrier
+
+    /**
+     * @brief Construct a new Barrier
+     * 
+     * @param count the amount of threads that have to arrive per phase
+     * @param completion a function that is called by one thread once all threads arrived or NULL
+     * @param data the data to pass to the completion function
+     */
+    inline s_Barrier(int64_t count, void (*completion)(void*) = nullptr, void* data = nullptr)
+     : barrier((std::ptrdiff_t)count, BarrierCompletion{completion, data})
+    {}
+
+    /**
+     * @brief Destroy the Barrier
+     */
+    ~s_Barrier() {}
+
+    /**
+     * @brief arrive at the barrier and wait till all threads arrived
+     */
+    inline void arrive_and_wait() {barrier.arrive_and_wait();}
+
+    /**
+     * @brief arrive at the barrier and remove the calling thread from all following phases
+     */
+    inline void arrive_and_drop() {barrier.arrive_and_drop();}
+
+    #else
+
+    //for windows, add a single byte here to make the struct contain something
+    uint8_t byte;
+
+    #endif
+
+    //for C, this is an opaque structure
+
+} Barrier;
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief create a new barrier
+ * 
+ * @param count the amount of threads that have to arrive per phase
+ * @return Barrier* a pointer to the new barrier
+ */
+Barrier* barrier_Create(int64_t count);
+
+/**
+ * @brief create a new barrier that calls a function once per phase
+ * 
+ * @param count the amount of threads that have to arrive per phase
+ * @param completion a function that is called by one thread once all threads arrived
+ * @param data the data to pass to the completion function
+ * @return Barrier* a pointer to the new barrier
+ */
+Barrier* barrier_CreateWithCompletion(int64_t count, void (*completion)(void*), void* data);
+
+/**
+ * @brief destroy a barrier
+ * 
+ * @param barrier a pointer to the barrier to destroy
+ */
+void barrier_Destroy(Barrier* barrier);
+
+/**
+ * @brief arrive at a barrier and wait till all threads arrived
+ * 
+ * @param barrier a pointer to the barrier to arrive at
+ */
+void barrier_Arrive_and_wait(Barrier* barrier);
+
+/**
+ * @brief arrive at a barrier and remove the calling thread from all following phases
+ * 
+ * @param barrier a pointer to the barrier to arrive at
+ */
+void barrier_Arrive_and_drop(Barrier* barrier);
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+#endif
@@ -13,6 +13,20 @@
 #include "Vector.h"
 //include a mutex
 #include "Mutex.h"
+//include a shared mutex
+#include "SharedMutex.h"
+//include a sequence lock
+#include "SeqLock.h"
+//include atomics
+#include "Atomic.h"
+//include condition variables
+#include "ConditionVariable.h"
+//include semaphores
+#include "Semaphore.h"
+//include barriers
+#include "Barrier.h"
+//include latches
+#include "Latch.h"
 //include threads
 #include "Thread.h"
 //include strings
@@ -0,0 +1,29 @@
+/**
+ * @file ConditionVariable.cpp
+ * @author DM8AT
+ * @brief implement the C binding for the condition variable structure
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the condition variable
+#include "ConditionVariable.h"
+
+extern "C" {
+
+ConditionVariable* conditionVariable_Create() {return new ConditionVariable;}
+
+void conditionVariable_Destroy(ConditionVariable* cond) {delete cond;}
+
+void conditionVariable_Wait(Mutex* mut, ConditionVariable* cond) {cond->wait(*mut);}
+
+bool conditionVariable_WaitFor(Mutex* mut, uint64_t microseconds, ConditionVariable* cond) {return cond->wait_for(*mut, microseconds);}
+
+void conditionVariable_NotifyOne(ConditionVariable* cond) {cond->notify_one();}
+
+void conditionVariable_NotifyAll(ConditionVariable* cond) {cond->notify_all();}
+
+}
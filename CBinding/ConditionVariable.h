@@ -0,0 +1,161 @@
+/**
+ * @file ConditionVariable.h
+ * @author DM8AT
+ * @brief a C binding for a C++ condition variable that works together with the mutex binding
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_C_CONDITION_VARIABLE_
+#define _GLGE_C_CONDITION_VARIABLE_
+
+//condition variables always wait on a mutex
+#include "Mutex.h"
+
+//include the condition variable from the default library for C++
+#if __cplusplus
+#include <condition_variable>
+#include <chrono>
+#endif
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+/**
+ * @brief store a condition variable. A condition variable lets threads sleep till another thread notifies them.
+ * 
+ * Waiting threads must hold the mutex they wait with. The mutex is released while sleeping and locked again before
+ * the wait returns. Spurious wake ups are possible, so the waited for condition must be checked in a loop.
+ */
+typedef struct s_ConditionVariable {
+
+    //if this is C++, add a condition variable in here
+    #if __cplusplus
+    std::condition_variable cond;
+
+    //add the interface for the condition variable
+
+    /**
+     * @brief Construct a new Condition Variable
+     */
+    inline s_ConditionVariable() = default;
+
+    /**
+     * @brief Destroy the Condition Variable
+     */
+    ~s_ConditionVariable() {}
+
+    /**
+     * @brief wait till the condition variable is notified
+     * 
+     * @param mut the mutex to wait with. Must be locked by the calling thread.
+     */
+    inline void wait(Mutex& mut)
+    {
+        //the mutex is already locked, so adopt it for the wait and give it back afterwards
+        std::unique_lock<std::mutex> lock(mut.mutex, std::adopt_lock);
+        cond.wait(lock);
+        lock.release();
+    }
+
+    /**
+     * @brief wait till the condition variable is notified or the timeout elapsed
+     * 
+     * @param mut the mutex to wait with. Must be locked by the calling thread.
+     * @param microseconds the maximum amount of microseconds to wait
+     * @return true : the wait returned before the timeout (notified or spurious wake up)
+     * @return false : the timeout elapsed
+     */
+    inline bool wait_for(Mutex& mut, uint64_t microseconds)
+    {
+        std::unique_lock<std::mutex> lock(mut.mutex, std::adopt_lock);
+        bool ret = cond.wait_for(lock, std::chrono::microseconds(microseconds)) == std::cv_status::no_timeout;
+        lock.release();
+        return ret;
+    }
+
+    /**
+     * @brief wake up a single waiting thread
+     */
+    inline void notify_one() noexcept {cond.notify_one();}
+
+    /**
+     * @brief wake up all waiting threads
+     */
+    inline void notify_all() noexcept {cond.notify_all();}
+
+    #else
+
+    //for windows, add a single byte here to make the struct contain something
+    uint8_t byte;
+
+    #endif
+
+    //for C, this is an opaque structure
+
+} ConditionVariable;
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief create a new condition variable
+ * 
+ * @return ConditionVariable* a pointer to the new condition variable
+ */
+ConditionVariable* conditionVariable_Create();
+
+/**
+ * @brief destroy a condition variable
+ * 
+ * @param cond a pointer to the condition variable to destroy
+ */
+void conditionVariable_Destroy(ConditionVariable* cond);
+
+/**
+ * @brief wait till a condition variable is notified
+ * 
+ * @param mut the mutex to wait with. Must be locked by the calling thread and is locked again when this returns.
+ * @param cond a pointer to the condition variable to wait on
+ */
+void conditionVariable_Wait(Mutex* mut, ConditionVariable* cond);
+
+/**
+ * @brief wait till a condition variable is notified or the timeout elapsed
+ * 
+ * @param mut the mutex to wait with. Must be locked by the calling thread and is locked again when this returns.
+ * @param microseconds the maximum amount of microseconds to wait
+ * @param cond a pointer to the condition variable to wait on
+ * @return true : the wait returned before the timeout (notified or spurious wake up)
+ * @return false : the timeout elapsed
+ */
+bool conditionVariable_WaitFor(Mutex* mut, uint64_t microseconds, ConditionVariable* cond);
+
+/**
+ * @brief wake up a single thread waiting on a condition variable
+ * 
+ * @param cond a pointer to the condition variable to notify
+ */
+void conditionVariable_NotifyOne(ConditionVariable* cond);
+
+/**
+ * @brief wake up all threads waiting on a condition variable
+ * 
+ * @param cond a pointer to the condition variable to notify
+ */
+void conditionVariable_NotifyAll(ConditionVariable* cond);
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,29 @@
+/**
+ * @file Latch.cpp
+ * @author DM8AT
+ * @brief implement the C binding for the latch structure
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the latch
+#include "Latch.h"
+
+extern "C" {
+
+Latch* latch_Create(int64_t count) {return new Latch(count);}
+
+void latch_Destroy(Latch* latch) {delete latch;}
+
+void latch_Count_down(int64_t n, Latch* latch) {latch->count_down(n);}
+
+bool latch_Try_wait(const Latch* latch) {return latch->try_wait();}
+
+void latch_Wait(const Latch* latch) {latch->wait();}
+
+void latch_Arrive_and_wait(int64_t n, Latch* latch) {latch->arrive_and_wait(n);}
+
+}
@@ -0,0 +1,144 @@
+/**
+ * @file Latch.h
+ * @author DM8AT
+ * @brief a C binding for a C++ latch
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_C_LATCH_
+#define _GLGE_C_LATCH_
+
+//include the latch from the default library for C++
+#if __cplusplus
+#include <latch>
+#endif
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+/**
+ * @brief store a latch. A latch is a single-use counter: threads can wait till it was counted down to zero.
+ */
+typedef struct s_Latch {
+
+    //if this is C++, add a latch in here
+    #if __cplusplus
+    std::latch latch;
+
+    //add the interface for the latch
+
+    /**
+     * @brief Construct a new Latch
+     * 
+     * @param count the amount of count downs needed to open the latch
+     */
+    inline s_Latch(int64_t count) : latch((std::ptrdiff_t)count) {}
+
+    /**
+     * @brief Destroy the Latch
+     */
+    ~s_Latch() {}
+
+    /**
+     * @brief decrement the counter without waiting
+     * 
+     * @param n the amount to decrement the counter by
+     */
+    inline void count_down(int64_t n = 1) {latch.count_down((std::ptrdiff_t)n);}
+
+    /**
+     * @brief check if the counter reached zero
+     * 
+     * @return true : the latch is open
+     * @return false : the latch is still closed
+     */
+    inline bool try_wait() const noexcept {return latch.try_wait();}
+
+    /**
+     * @brief wait till the counter reached zero
+     */
+    inline void wait() const {latch.wait();}
+
+    /**
+     * @brief decrement the counter and wait till it reached zero
+     * 
+     * @param n the amount to decrement the counter by
+     */
+    inline void arrive_and_wait(int64_t n = 1) {latch.arrive_and_wait((std::ptrdiff_t)n);}
+
+    #else
+
+    //for windows, add a single byte here to make the struct contain something
+    uint8_t byte;
+
+    #endif
+
+    //for C, this is an opaque structure
+
+} Latch;
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief create a new latch
+ * 
+ * @param count the amount of count downs needed to open the latch
+ * @return Latch* a pointer to the new latch
+ */
+Latch* latch_Create(int64_t count);
+
+/**
+ * @brief destroy a latch
+ * 
+ * @param latch a pointer to the latch to destroy
+ */
+void latch_Destroy(Latch* latch);
+
+/**
+ * @brief decrement the counter of a latch without waiting
+ * 
+ * @param n the amount to decrement the counter by
+ * @param latch a pointer to the latch to count down
+ */
+void latch_Count_down(int64_t n, Latch* latch);
+
+/**
+ * @brief check if the counter of a latch reached zero
+ * 
+ * @param latch a pointer to the latch to check
+ * @return true : the latch is open
+ * @return false : the latch is still closed
+ */
+bool latch_Try_wait(const Latch* latch);
+
+/**
+ * @brief wait till the counter of a latch reached zero
+ * 
+ * @param latch a pointer to the latch to wait for
+ */
+void latch_Wait(const Latch* latch);
+
+/**
+ * @brief decrement the counter of a latch and wait till it reached zero
+ * 
+ * @param n the amount to decrement the counter by
+ * @param latch a pointer to the latch to arrive at
+ */
+void latch_Arrive_and_wait(int64_t n, Latch* latch);
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+#endif
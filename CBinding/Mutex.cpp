@@ -12,10 +12,187 @@
 //include the mutex
 #include "Mutex.h"
 
+//the statistics are printed to the console
+#include <cstdio>
+
+#if GLGE_BG_PROFILE_MUTEX
+
+//include the storage of the statistics
+#include <atomic>
+#include <string>
+#include <deque>
+#include <bit>
+
+/**
+ * @brief store the statistics of all mutexes with the same name
+ * 
+ * All values are only changed by the thread that holds one of the mutexes. They are still atomics, so snapshots can be
+ * taken at any time. Mutexes with the same name may be locked at the same time, so the changes are atomic operations.
+ */
+struct MutexProfile
+{
+    /**
+     * @brief the name of the mutexes
+     */
+    std::string name;
+    /**
+     * @brief the amount of times a mutex was locked
+     */
+    std::atomic<uint64_t> acquisitions{0};
+    /**
+     * @brief the amount of times a thread had to wait
+     */
+    std::atomic<uint64_t> contended{0};
+    /**
+     * @brief the total wait time in nanoseconds
+     */
+    std::atomic<uint64_t> totalWaitNs{0};
+    /**
+     * @brief the longest wait time in nanoseconds
+     */
+    std::atomic<uint64_t> maxWaitNs{0};
+    /**
+     * @brief the total hold time in nanoseconds
+     */
+    std::atomic<uint64_t> totalHoldNs{0};
+    /**
+     * @brief the histogram of the hold times
+     */
+    std::atomic<uint64_t> holdHistogram[GLGE_MUTEX_HOLD_BUCKETS]{};
+
+    /**
+     * @brief fill a C statistics structure with the current values
+     * 
+     * @param stats the structure to fill
+     */
+    void snapshot(MutexStats& stats) const noexcept
+    {
+        stats.name = name.c_str();
+        stats.acquisitions = acquisitions.load(std::memory_order_relaxed);
+        stats.contended = contended.load(std::memory_order_relaxed);
+        stats.totalWaitNs = totalWaitNs.load(std::memory_order_relaxed);
+        stats.maxWaitNs = maxWaitNs.load(std::memory_order_relaxed);
+        stats.totalHoldNs = totalHoldNs.load(std::memory_order_relaxed);
+        for (uint32_t i = 0; i < GLGE_MUTEX_HOLD_BUCKETS; ++i) {stats.holdHistogram[i] = holdHistogram[i].load(std::memory_order_relaxed);}
+    }
+
+    /**
+     * @brief set all values back to 0
+     */
+    void reset() noexcept
+    {
+        acquisitions.store(0, std::memory_order_relaxed);
+        contended.store(0, std::memory_order_relaxed);
+        totalWaitNs.store(0, std::memory_order_relaxed);
+        maxWaitNs.store(0, std::memory_order_relaxed);
+        totalHoldNs.store(0, std::memory_order_relaxed);
+        for (uint32_t i = 0; i < GLGE_MUTEX_HOLD_BUCKETS; ++i) {holdHistogram[i].store(0, std::memory_order_relaxed);}
+    }
+};
+
+/**
+ * @brief store the statistics of all names. The statistics are never freed, so they survive the mutexes.
+ */
+struct MutexRegistry
+{
+    /**
+     * @brief the registry is accessed rarely, so a plain mutex is fine. It is never profiled itself.
+     */
+    std::mutex mutex;
+    /**
+     * @brief the statistics. A deque is used so the elements never move.
+     */
+    std::deque<MutexProfile> profiles;
+};
+
+/**
+ * @brief get the registry of all statistics. It is never destroyed, so mutexes in static objects can use it on exit.
+ * 
+ * @return MutexRegistry& a reference to the registry
+ */
+static MutexRegistry& __mutexRegistry()
+{
+    static MutexRegistry* registry = new MutexRegistry;
+    return *registry;
+}
+
+/**
+ * @brief get the time between two points in nanoseconds
+ * 
+ * @param start the earlier time point
+ * @param end the later time point
+ * @return uint64_t the time in nanoseconds
+ */
+static inline uint64_t __mutexNs(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();}
+
+void s_Mutex::setName(const char* name)
+{
+    if (!name) {m_profile = nullptr; return;}
+
+    //search the statistics for the name or create them
+    MutexRegistry& registry = __mutexRegistry();
+    std::lock_guard<std::mutex> guard(registry.mutex);
+    for (MutexProfile& profile : registry.profiles)
+    {if (profile.name == name) {m_profile = &profile; return;}}
+    m_profile = &registry.profiles.emplace_back();
+    m_profile->name = name;
+}
+
+void s_Mutex::lockProfiled()
+{
+    //the fast path is a lock without waiting
+    if (mutex.try_lock()) {m_acquired = std::chrono::steady_clock::now();}
+    else
+    {
+        //measure how long the thread has to wait
+        auto start = std::chrono::steady_clock::now();
+        mutex.lock();
+        m_acquired = std::chrono::steady_clock::now();
+        uint64_t wait = __mutexNs(start, m_acquired);
+
+        m_profile->contended.fetch_add(1, std::memory_order_relaxed);
+        m_profile->totalWaitNs.fetch_add(wait, std::memory_order_relaxed);
+        uint64_t max = m_profile->maxWaitNs.load(std::memory_order_relaxed);
+        while ((wait > max) && !m_profile->maxWaitNs.compare_exchange_weak(max, wait, std::memory_order_relaxed)) {}
+    }
+    m_profile->acquisitions.fetch_add(1, std::memory_order_relaxed);
+}
+
+void s_Mutex::unlockProfiled()
+{
+    //record the hold time before the mutex is released
+    uint64_t hold = __mutexNs(m_acquired, std::chrono::steady_clock::now());
+    m_profile->totalHoldNs.fetch_add(hold, std::memory_order_relaxed);
+
+    //bucket 0 is below 256ns, then one bucket per power of two
+    uint32_t bucket = 0;
+    if (hold >= 256)
+    {
+        bucket = (uint32_t)std::bit_width(hold) - 8;
+        bucket = (bucket >= GLGE_MUTEX_HOLD_BUCKETS) ? (GLGE_MUTEX_HOLD_BUCKETS - 1) : bucket;
+    }
+    m_profile->holdHistogram[bucket].fetch_add(1, std::memory_order_relaxed);
+
+    mutex.unlock();
+}
+
+bool s_Mutex::tryLockProfiled()
+{
+    if (!mutex.try_lock()) {return false;}
+    m_acquired = std::chrono::steady_clock::now();
+    m_profile->acquisitions.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+#endif
+
 extern "C" {
 
 Mutex* mutex_Create() {return new Mutex;}
 
+Mutex* mutex_CreateNamed(const char* name) {return new Mutex(name);}
+
 void mutex_Destroy(Mutex* mut) {delete mut;}
 
 void mutex_Lock(Mutex* mut) {mut->lock();}
@@ -24,4 +201,81 @@ void mutex_Unlock(Mutex* mut) {mut->unlock();}
 
 bool mutex_Try_lock(Mutex* mut) {return mut->try_lock();}
 
+void mutex_SetName(const char* name, Mutex* mut) {mut->setName(name);}
+
+#if GLGE_BG_PROFILE_MUTEX
+
+bool mutexStats_Enabled() {return true;}
+
+uint64_t mutexStats_Count()
+{
+    MutexRegistry& registry = __mutexRegistry();
+    std::lock_guard<std::mutex> guard(registry.mutex);
+    return registry.profiles.size();
+}
+
+bool mutexStats_Get(uint64_t index, MutexStats* stats)
+{
+    MutexRegistry& registry = __mutexRegistry();
+    std::lock_guard<std::mutex> guard(registry.mutex);
+    if (index >= registry.profiles.size()) {return false;}
+    registry.profiles[index].snapshot(*stats);
+    return true;
+}
+
+void mutexStats_Iterate(void (*func)(const MutexStats* stats, void* userData), void* userData)
+{
+    //profiles are never removed, so the registry only needs to be locked to read the size
+    for (uint64_t i = 0; i < mutexStats_Count(); ++i)
+    {
+        MutexStats stats;
+        if (mutexStats_Get(i, &stats)) {(*func)(&stats, userData);}
+    }
+}
+
+void mutexStats_Reset()
+{
+    MutexRegistry& registry = __mutexRegistry();
+    std::lock_guard<std::mutex> guard(registry.mutex);
+    for (MutexProfile& profile : registry.profiles) {profile.reset();}
+}
+
+#else
+
+bool mutexStats_Enabled() {return false;}
+
+uint64_t mutexStats_Count() {return 0;}
+
+bool mutexStats_Get(uint64_t, MutexStats*) {return false;}
+
+void mutexStats_Iterate(void (*)(const MutexStats*, void*), void*) {}
+
+void mutexStats_Reset() {}
+
+#endif
+
+void mutexStats_Dump()
+{
+    if (!mutexStats_Enabled()) {printf("mutex profiling is disabled (build with GLGE_BG_PROFILE_MUTEX)\n"); return;}
+
+    printf("%-24s %12s %12s %12s %12s %12s\n", "mutex", "locks", "contended", "avg wait us", "max wait us", "avg hold us");
+    mutexStats_Iterate([](const MutexStats* s, void*) {
+        double locks = (s->acquisitions == 0) ? 1.0 : (double)s->acquisitions;
+        double contended = (s->contended == 0) ? 1.0 : (double)s->contended;
+        printf("%-24s %12llu %12llu %12.3f %12.3f %12.3f\n", s->name, (unsigned long long)s->acquisitions, (unsigned long long)s->contended,
+               (double)s->totalWaitNs / contended / 1000.0, (double)s->maxWaitNs / 1000.0, (double)s->totalHoldNs / locks / 1000.0);
+        //print all used buckets of the hold time histogram with their lower bound
+        printf("%-24s", "  hold times");
+        for (uint32_t i = 0; i < GLGE_MUTEX_HOLD_BUCKETS; ++i)
+        {
+            if (s->holdHistogram[i] == 0) {continue;}
+            uint64_t lower = (i == 0) ? 0 : (128ull << i);
+            if (lower >= 1000000) {printf(" >=%llums:%llu", (unsigned long long)(lower / 1000000), (unsigned long long)s->holdHistogram[i]);}
+            else if (lower >= 1000) {printf(" >=%lluus:%llu", (unsigned long long)(lower / 1000), (unsigned long long)s->holdHistogram[i]);}
+            else {printf(" >=%lluns:%llu", (unsigned long long)lower, (unsigned long long)s->holdHistogram[i]);}
+        }
+        printf("\n");
+    }, nullptr);
+}
+
 }
\ No newline at end of file
@@ -19,6 +19,65 @@
 #endif
 //booleans are required
 #include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+//the contention profiling is opt-in (CMake option GLGE_BG_PROFILE_MUTEX). Without it, the mutex is a plain std::mutex.
+#ifndef GLGE_BG_PROFILE_MUTEX
+#define GLGE_BG_PROFILE_MUTEX 0
+#endif
+
+//profiled mutexes measure their wait and hold times
+#if __cplusplus && GLGE_BG_PROFILE_MUTEX
+#include <chrono>
+#endif
+
+/**
+ * @brief the amount of buckets of the hold time histogram of a mutex
+ * 
+ * Bucket 0 counts hold times below 256 nanoseconds, bucket i counts hold times in [128 * 2^i, 256 * 2^i) nanoseconds 
+ * and the last bucket counts all longer hold times.
+ */
+#define GLGE_MUTEX_HOLD_BUCKETS 20
+
+/**
+ * @brief store the contention statistics of all mutexes with the same name
+ */
+typedef struct s_MutexStats {
+    /**
+     * @brief the name of the mutex
+     */
+    const char* name;
+    /**
+     * @brief the amount of times the mutex was locked
+     */
+    uint64_t acquisitions;
+    /**
+     * @brief the amount of times a thread had to wait because the mutex was already locked
+     */
+    uint64_t contended;
+    /**
+     * @brief the total time threads waited for the mutex in nanoseconds
+     */
+    uint64_t totalWaitNs;
+    /**
+     * @brief the longest time a thread waited for the mutex in nanoseconds
+     */
+    uint64_t maxWaitNs;
+    /**
+     * @brief the total time the mutex was locked in nanoseconds. Waiting on a condition variable counts as locked.
+     */
+    uint64_t totalHoldNs;
+    /**
+     * @brief a histogram of the hold times, see GLGE_MUTEX_HOLD_BUCKETS
+     */
+    uint64_t holdHistogram[GLGE_MUTEX_HOLD_BUCKETS];
+} MutexStats;
+
+//the statistics storage is only known to the implementation
+#if __cplusplus
+struct MutexProfile;
+#endif
 
 /**
  * @brief store a mutex. A mutex is a structure used for thread synchronisation. 
@@ -36,11 +95,47 @@ typedef struct s_Mutex {
      */
     inline s_Mutex() = default;
 
+    /**
+     * @brief Construct a new named Mutex. With GLGE_BG_PROFILE_MUTEX, contention statistics are recorded for the name.
+     * 
+     * @param name the name of the mutex. All mutexes with the same name share their statistics.
+     */
+    inline s_Mutex(const char* name) {setName(name);}
+
     /**
      * @brief Destroy the Mutex
      */
     ~s_Mutex() {}
 
+    #if GLGE_BG_PROFILE_MUTEX
+
+    /**
+     * @brief lock the mutex
+     */
+    inline void lock()  {if (m_profile) {lockProfiled();} else {mutex.lock();}}
+
+    /**
+     * @brief unlock the mutex
+     */
+    inline void unlock() {if (m_profile) {unlockProfiled();} else {mutex.unlock();}}
+
+    /**
+     * @brief try to lock the mutex
+     * 
+     * @return true : the mutex was locked
+     * @return false : failed to lock the mutex -> it is locked
+     */
+    inline bool try_lock() {return m_profile ? tryLockProfiled() : mutex.try_lock();}
+
+    /**
+     * @brief set the name the statistics of the mutex are recorded for. Must not be called while the mutex is locked.
+     * 
+     * @param name the name of the mutex or NULL to stop recording
+     */
+    void setName(const char* name);
+
+    #else
+
     /**
      * @brief lock the mutex
      */
@@ -59,6 +154,48 @@ typedef struct s_Mutex {
      */
     inline bool try_lock() {return mutex.try_lock();}
 
+    /**
+     * @brief set the name the statistics of the mutex are recorded for. Does nothing without GLGE_BG_PROFILE_MUTEX.
+     * 
+     * @param name the name of the mutex
+     */
+    inline void setName(const char*) {}
+
+    #endif
+
+protected:
+
+    #if GLGE_BG_PROFILE_MUTEX
+
+    /**
+     * @brief lock the mutex and record the wait time
+     */
+    void lockProfiled();
+
+    /**
+     * @brief record the hold time and unlock the mutex
+     */
+    void unlockProfiled();
+
+    /**
+     * @brief try to lock the mutex and record the acquisition
+     * 
+     * @return true : the mutex was locked
+     * @return false : the mutex is locked
+     */
+    bool tryLockProfiled();
+
+    /**
+     * @brief the statistics of the mutex or NULL if the mutex has no name
+     */
+    MutexProfile* m_profile = nullptr;
+    /**
+     * @brief the time the mutex was locked at
+     */
+    std::chrono::steady_clock::time_point m_acquired;
+
+    #endif
+
     #else
 
     //for windows, add a single byte here to make the struct contain something
@@ -83,6 +220,14 @@ extern "C" {
  */
 Mutex* mutex_Create();
 
+/**
+ * @brief create a new named mutex. With GLGE_BG_PROFILE_MUTEX, contention statistics are recorded for the name.
+ * 
+ * @param name the name of the mutex. All mutexes with the same name share their statistics.
+ * @return Mutex* a pointer to the new mutex
+ */
+Mutex* mutex_CreateNamed(const char* name);
+
 /**
  * @brief destroy a mutex
  * 
@@ -113,6 +258,57 @@ void mutex_Unlock(Mutex* mut);
  */
 bool mutex_Try_lock(Mutex* mut);
 
+/**
+ * @brief set the name the statistics of a mutex are recorded for. Must not be called while the mutex is locked.
+ * 
+ * @param name the name of the mutex or NULL to stop recording
+ * @param mut a pointer to the mutex to perform the operation on
+ */
+void mutex_SetName(const char* name, Mutex* mut);
+
+/**
+ * @brief check if the mutex contention profiling was compiled in
+ * 
+ * @return true : named mutexes record statistics
+ * @return false : the library was built without GLGE_BG_PROFILE_MUTEX
+ */
+bool mutexStats_Enabled();
+
+/**
+ * @brief get the amount of names statistics are recorded for
+ * 
+ * @return uint64_t the amount of names. Always 0 without GLGE_BG_PROFILE_MUTEX.
+ */
+uint64_t mutexStats_Count();
+
+/**
+ * @brief get a snapshot of the statistics of a single name
+ * 
+ * @param index the index of the name, smaller than mutexStats_Count()
+ * @param stats the structure to fill
+ * @return true : the statistics were written
+ * @return false : the index is out of range
+ */
+bool mutexStats_Get(uint64_t index, MutexStats* stats);
+
+/**
+ * @brief call a function with a snapshot of the statistics of every name
+ * 
+ * @param func the function to call. The statistics are only valid during the call.
+ * @param userData the data to pass to the function
+ */
+void mutexStats_Iterate(void (*func)(const MutexStats* stats, void* userData), void* userData);
+
+/**
+ * @brief print a table of the statistics of all names to the standard output
+ */
+void mutexStats_Dump();
+
+/**
+ * @brief reset the statistics of all names to 0
+ */
+void mutexStats_Reset();
+
 //the the extern section in C++
 #if __cplusplus
 }
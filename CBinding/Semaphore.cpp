@@ -0,0 +1,29 @@
+/**
+ * @file Semaphore.cpp
+ * @author DM8AT
+ * @brief implement the C binding for the semaphore structure
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the semaphore
+#include "Semaphore.h"
+
+extern "C" {
+
+Semaphore* semaphore_Create(int32_t initial) {return new Semaphore(initial);}
+
+void semaphore_Destroy(Semaphore* sem) {delete sem;}
+
+void semaphore_Acquire(Semaphore* sem) {sem->acquire();}
+
+bool semaphore_Try_acquire(Semaphore* sem) {return sem->try_acquire();}
+
+bool semaphore_Try_acquire_for(uint64_t microseconds, Semaphore* sem) {return sem->try_acquire_for(microseconds);}
+
+void semaphore_Release(int32_t n, Semaphore* sem) {sem->release(n);}
+
+}
@@ -0,0 +1,149 @@
+/**
+ * @file Semaphore.h
+ * @author DM8AT
+ * @brief a C binding for a C++ counting semaphore
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_C_SEMAPHORE_
+#define _GLGE_C_SEMAPHORE_
+
+//include the semaphore from the default library for C++
+#if __cplusplus
+#include <semaphore>
+#include <chrono>
+#endif
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+/**
+ * @brief store a counting semaphore. Acquiring decrements the counter and blocks while it is zero, releasing increments it.
+ */
+typedef struct s_Semaphore {
+
+    //if this is C++, add a semaphore in here
+    #if __cplusplus
+    std::counting_semaphore<INT32_MAX> semaphore;
+
+    //add the interface for the semaphore
+
+    /**
+     * @brief Construct a new Semaphore
+     * 
+     * @param initial the initial value of the counter
+     */
+    inline s_Semaphore(int32_t initial = 0) : semaphore(initial) {}
+
+    /**
+     * @brief Destroy the Semaphore
+     */
+    ~s_Semaphore() {}
+
+    /**
+     * @brief decrement the counter or wait till it is possible
+     */
+    inline void acquire() {semaphore.acquire();}
+
+    /**
+     * @brief try to decrement the counter without waiting
+     * 
+     * @return true : the counter was decremented
+     * @return false : the counter is zero
+     */
+    inline bool try_acquire() noexcept {return semaphore.try_acquire();}
+
+    /**
+     * @brief try to decrement the counter and wait at most the given time
+     * 
+     * @param microseconds the maximum amount of microseconds to wait
+     * @return true : the counter was decremented
+     * @return false : the timeout elapsed
+     */
+    inline bool try_acquire_for(uint64_t microseconds) {return semaphore.try_acquire_for(std::chrono::microseconds(microseconds));}
+
+    /**
+     * @brief increment the counter and wake up waiting threads
+     * 
+     * @param n the amount to increment the counter by
+     */
+    inline void release(int32_t n = 1) {semaphore.release(n);}
+
+    #else
+
+    //for windows, add a single byte here to make the struct contain something
+    uint8_t byte;
+
+    #endif
+
+    //for C, this is an opaque structure
+
+} Semaphore;
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief create a new semaphore
+ * 
+ * @param initial the initial value of the counter
+ * @return Semaphore* a pointer to the new semaphore
+ */
+Semaphore* semaphore_Create(int32_t initial);
+
+/**
+ * @brief destroy a semaphore
+ * 
+ * @param sem a pointer to the semaphore to destroy
+ */
+void semaphore_Destroy(Semaphore* sem);
+
+/**
+ * @brief decrement the counter of a semaphore or wait till it is possible
+ * 
+ * @param sem a pointer to the semaphore to acquire
+ */
+void semaphore_Acquire(Semaphore* sem);
+
+/**
+ * @brief try to decrement the counter of a semaphore without waiting
+ * 
+ * @param sem a pointer to the semaphore to acquire
+ * @return true : the counter was decremented
+ * @return false : the counter is zero
+ */
+bool semaphore_Try_acquire(Semaphore* sem);
+
+/**
+ * @brief try to decrement the counter of a semaphore and wait at most the given time
+ * 
+ * @param microseconds the maximum amount of microseconds to wait
+ * @param sem a pointer to the semaphore to acquire
+ * @return true : the counter was decremented
+ * @return false : the timeout elapsed
+ */
+bool semaphore_Try_acquire_for(uint64_t microseconds, Semaphore* sem);
+
+/**
+ * @brief increment the counter of a semaphore and wake up waiting threads
+ * 
+ * @param n the amount to increment the counter by
+ * @param sem a pointer to the semaphore to release
+ */
+void semaphore_Release(int32_t n, Semaphore* sem);
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+#endif
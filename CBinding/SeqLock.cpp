@@ -0,0 +1,106 @@
+/**
+ * @file SeqLock.cpp
+ * @author DM8AT
+ * @brief implement the sequence lock and its C binding
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the sequence lock
+#include "SeqLock.h"
+
+//memory management stuff
+#include <cstring>
+//for the spin hint
+#include <thread>
+
+s_SeqLock::s_SeqLock(uint64_t _byteSize, const void* initial) noexcept
+ : m_wordCount((_byteSize + sizeof(uint64_t) - 1) / sizeof(uint64_t)), m_byteSize(_byteSize)
+{
+    //allocate the words. Atomics are zero initialized.
+    m_words = new std::atomic<uint64_t>[(m_wordCount == 0) ? 1 : m_wordCount]();
+    //if initial data is given, store it
+    if (initial) {write(initial);}
+}
+
+s_SeqLock::~s_SeqLock()
+{
+    //free the data
+    delete[] m_words;
+}
+
+void s_SeqLock::write(const void* data) noexcept
+{
+    //only one writer at a time
+    std::lock_guard<std::mutex> guard(m_writeMutex);
+
+    //mark the write as in progress by making the sequence odd
+    uint64_t seq = m_sequence.load(std::memory_order_relaxed);
+    m_sequence.store(seq + 1, std::memory_order_relaxed);
+    //make sure the odd sequence is visible before any of the data changes
+    std::atomic_thread_fence(std::memory_order_release);
+
+    //copy the data word by word
+    const uint8_t* src = (const uint8_t*)data;
+    for (uint64_t i = 0; i < m_wordCount; ++i)
+    {
+        //the last word may only be partially used
+        uint64_t bytes = m_byteSize - i*sizeof(uint64_t);
+        bytes = (bytes > sizeof(uint64_t)) ? sizeof(uint64_t) : bytes;
+        uint64_t word = 0;
+        memcpy(&word, src + i*sizeof(uint64_t), bytes);
+        m_words[i].store(word, std::memory_order_relaxed);
+    }
+
+    //publish the write by making the sequence even again
+    m_sequence.store(seq + 2, std::memory_order_release);
+}
+
+bool s_SeqLock::tryRead(void* out) const noexcept
+{
+    //get the sequence before reading
+    uint64_t before = m_sequence.load(std::memory_order_acquire);
+    //if a write is in progress, the snapshot can't be consistent
+    if (before & 1) {return false;}
+
+    //copy the data word by word
+    uint8_t* dst = (uint8_t*)out;
+    for (uint64_t i = 0; i < m_wordCount; ++i)
+    {
+        uint64_t word = m_words[i].load(std::memory_order_relaxed);
+        uint64_t bytes = m_byteSize - i*sizeof(uint64_t);
+        bytes = (bytes > sizeof(uint64_t)) ? sizeof(uint64_t) : bytes;
+        memcpy(dst + i*sizeof(uint64_t), &word, bytes);
+    }
+
+    //make sure all data loads happen before the sequence is checked again
+    std::atomic_thread_fence(std::memory_order_acquire);
+    //the snapshot is consistent if no write started in between
+    return m_sequence.load(std::memory_order_relaxed) == before;
+}
+
+void s_SeqLock::read(void* out) const noexcept
+{
+    //retry until a consistent snapshot was read
+    while (!tryRead(out)) {std::this_thread::yield();}
+}
+
+
+extern "C" {
+
+SeqLock* seqLock_Create(uint64_t byteSize, const void* initial) {return new SeqLock(byteSize, initial);}
+
+void seqLock_Destroy(SeqLock* lock) {delete lock;}
+
+void seqLock_Write(const void* data, SeqLock* lock) {lock->write(data);}
+
+void seqLock_Read(void* out, const SeqLock* lock) {lock->read(out);}
+
+bool seqLock_TryRead(void* out, const SeqLock* lock) {return lock->tryRead(out);}
+
+uint64_t seqLock_Size(const SeqLock* lock) {return lock->size();}
+
+}
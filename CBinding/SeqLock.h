@@ -0,0 +1,228 @@
+/**
+ * @file SeqLock.h
+ * @author DM8AT
+ * @brief define a sequence lock for small snapshots of plain old data
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_C_SEQ_LOCK_
+#define _GLGE_C_SEQ_LOCK_
+
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+//include atomics and mutexes for C++
+#if __cplusplus
+#include <atomic>
+#include <mutex>
+#include <type_traits>
+#endif
+
+/**
+ * @brief the size of a cache line the sequence lock pads its members to
+ */
+#define GLGE_C_SEQ_LOCK_CACHE_LINE 64
+
+/**
+ * @brief store a sequence lock. A sequence lock protects a small block of plain old data (POD).
+ * 
+ * Writers are serialized and bump a sequence counter before and after changing the data. Readers only
+ * read the counter and the data and retry if a write happened in between, so readers never write to a
+ * shared cache line and never block a writer. This is best for small snapshots that are read a lot more
+ * often than they are written.
+ */
+typedef struct s_SeqLock {
+
+    //if this is C++, add the actual lock in here
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new Seq Lock
+     * 
+     * @param _byteSize the size of the protected data in bytes
+     * @param initial the data to initialize the protected data with or NULL to zero-initialize it
+     */
+    s_SeqLock(uint64_t _byteSize, const void* initial = nullptr) noexcept;
+
+    /**
+     * @brief Destroy the Seq Lock
+     */
+    ~s_SeqLock();
+
+    /**
+     * @brief write a new snapshot of the protected data
+     * 
+     * @param data a pointer to the data to store. Must be byteSize bytes large.
+     */
+    void write(const void* data) noexcept;
+
+    /**
+     * @brief read a consistent snapshot of the protected data. Retries until no write interfered.
+     * 
+     * @param out a pointer to the memory to copy the snapshot to. Must be byteSize bytes large.
+     */
+    void read(void* out) const noexcept;
+
+    /**
+     * @brief try to read a consistent snapshot of the protected data a single time
+     * 
+     * @param out a pointer to the memory to copy the snapshot to. Must be byteSize bytes large.
+     * @return true : the snapshot is consistent
+     * @return false : a write interfered, the content of out is undefined
+     */
+    bool tryRead(void* out) const noexcept;
+
+    /**
+     * @brief get the size of the protected data in bytes
+     * 
+     * @return uint64_t the size of the protected data in bytes
+     */
+    inline uint64_t size() const noexcept {return m_byteSize;}
+
+    /**
+     * @brief get the amount of finished writes
+     * 
+     * @return uint64_t the amount of writes that finished since construction
+     */
+    inline uint64_t version() const noexcept {return m_sequence.load(std::memory_order_acquire) >> 1;}
+
+    /**
+     * @brief a typed helper to store a value
+     * 
+     * @tparam T the type of the value. Must be trivially copyable.
+     * @param value the value to store
+     * @return true : the value was stored
+     * @return false : the size of the value does not match the size of the lock, nothing was stored
+     */
+    template <typename T>
+    inline bool store(const T& value) noexcept
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "SeqLock can only protect trivially copyable types");
+        if (sizeof(T) != size()) {return false;}
+        write(&value);
+        return true;
+    }
+
+    /**
+     * @brief a typed helper to load a value
+     * 
+     * @tparam T the type of the value. Must be trivially copyable.
+     * @param value filled with the consistent snapshot of the value
+     * @return true : the value was loaded
+     * @return false : the size of the value does not match the size of the lock, the value is unchanged
+     */
+    template <typename T>
+    inline bool load(T& value) const noexcept
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "SeqLock can only protect trivially copyable types");
+        if (sizeof(T) != size()) {return false;}
+        read(&value);
+        return true;
+    }
+
+protected:
+
+    //the data readers touch lives on its own cache line(s)
+
+    /**
+     * @brief the sequence counter. Odd while a write is in progress.
+     */
+    alignas(GLGE_C_SEQ_LOCK_CACHE_LINE) std::atomic<uint64_t> m_sequence{0};
+    /**
+     * @brief store the protected data as words so readers can load it race-free
+     */
+    std::atomic<uint64_t>* m_words = nullptr;
+    /**
+     * @brief the amount of words in the data array
+     */
+    uint64_t m_wordCount = 0;
+    /**
+     * @brief the size of the protected data in bytes
+     */
+    uint64_t m_byteSize = 0;
+
+    /**
+     * @brief serialize the writers. Readers never touch this, so it is kept on a separate cache line.
+     */
+    alignas(GLGE_C_SEQ_LOCK_CACHE_LINE) std::mutex m_writeMutex;
+
+    #else
+
+    //for windows, add a single byte here to make the struct contain something
+    uint8_t byte;
+
+    #endif
+
+    //for C, this is an opaque structure
+
+} SeqLock;
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief create a new sequence lock
+ * 
+ * @param byteSize the size of the protected data in bytes
+ * @param initial the data to initialize the protected data with or NULL to zero-initialize it
+ * @return SeqLock* a pointer to the new sequence lock
+ */
+SeqLock* seqLock_Create(uint64_t byteSize, const void* initial);
+
+/**
+ * @brief destroy a sequence lock
+ * 
+ * @param lock a pointer to the sequence lock to destroy
+ */
+void seqLock_Destroy(SeqLock* lock);
+
+/**
+ * @brief write a new snapshot into a sequence lock
+ * 
+ * @param data a pointer to the data to store. Must be as large as the protected data.
+ * @param lock a pointer to the sequence lock to write to
+ */
+void seqLock_Write(const void* data, SeqLock* lock);
+
+/**
+ * @brief read a consistent snapshot from a sequence lock
+ * 
+ * @param out a pointer to the memory to copy the snapshot to. Must be as large as the protected data.
+ * @param lock a pointer to the sequence lock to read from
+ */
+void seqLock_Read(void* out, const SeqLock* lock);
+
+/**
+ * @brief try to read a consistent snapshot from a sequence lock a single time
+ * 
+ * @param out a pointer to the memory to copy the snapshot to. Must be as large as the protected data.
+ * @param lock a pointer to the sequence lock to read from
+ * @return true : the snapshot is consistent
+ * @return false : a write interfered, the content of out is undefined
+ */
+bool seqLock_TryRead(void* out, const SeqLock* lock);
+
+/**
+ * @brief get the size of the data protected by a sequence lock
+ * 
+ * @param lock a pointer to the sequence lock to quarry
+ * @return uint64_t the size of the protected data in bytes
+ */
+uint64_t seqLock_Size(const SeqLock* lock);
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,33 @@
+/**
+ * @file SharedMutex.cpp
+ * @author DM8AT
+ * @brief implement the C binding for the shared mutex structure
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the shared mutex
+#include "SharedMutex.h"
+
+extern "C" {
+
+SharedMutex* sharedMutex_Create() {return new SharedMutex;}
+
+void sharedMutex_Destroy(SharedMutex* mut) {delete mut;}
+
+void sharedMutex_Lock(SharedMutex* mut) {mut->lock();}
+
+void sharedMutex_Unlock(SharedMutex* mut) {mut->unlock();}
+
+bool sharedMutex_Try_lock(SharedMutex* mut) {return mut->try_lock();}
+
+void sharedMutex_Lock_shared(SharedMutex* mut) {mut->lock_shared();}
+
+void sharedMutex_Unlock_shared(SharedMutex* mut) {mut->unlock_shared();}
+
+bool sharedMutex_Try_lock_shared(SharedMutex* mut) {return mut->try_lock_shared();}
+
+}
@@ -0,0 +1,166 @@
+/**
+ * @file SharedMutex.h
+ * @author DM8AT
+ * @brief a C binding for a C++ shared mutex (reader-writer lock)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_C_SHARED_MUTEX_
+#define _GLGE_C_SHARED_MUTEX_
+
+//include the shared mutex from the default library for C++
+#if __cplusplus
+#include <shared_mutex>
+#endif
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+/**
+ * @brief store a shared mutex. A shared mutex can either be owned exclusively by a single writer or shared by any amount of readers.
+ * 
+ * This is meant for read-mostly data where readers should not serialize behind each other.
+ */
+typedef struct s_SharedMutex {
+
+    //if this is C++, add a shared mutex in here
+    #if __cplusplus
+    std::shared_mutex mutex;
+
+    //add the interface for the shared mutex
+
+    /**
+     * @brief Construct a new Shared Mutex
+     */
+    inline s_SharedMutex() = default;
+
+    /**
+     * @brief Destroy the Shared Mutex
+     */
+    ~s_SharedMutex() {}
+
+    /**
+     * @brief lock the mutex exclusively (for writing)
+     */
+    inline void lock() {mutex.lock();}
+
+    /**
+     * @brief unlock the exclusive ownership of the mutex
+     */
+    inline void unlock() {mutex.unlock();}
+
+    /**
+     * @brief try to lock the mutex exclusively
+     * 
+     * @return true : the mutex was locked
+     * @return false : failed to lock the mutex -> it is locked (shared or exclusive)
+     */
+    inline bool try_lock() {return mutex.try_lock();}
+
+    /**
+     * @brief lock the mutex for shared ownership (for reading)
+     */
+    inline void lock_shared() {mutex.lock_shared();}
+
+    /**
+     * @brief release the shared ownership of the mutex
+     */
+    inline void unlock_shared() {mutex.unlock_shared();}
+
+    /**
+     * @brief try to lock the mutex for shared ownership
+     * 
+     * @return true : shared ownership was acquired
+     * @return false : failed to lock the mutex -> it is locked exclusively
+     */
+    inline bool try_lock_shared() {return mutex.try_lock_shared();}
+
+    #else
+
+    //for windows, add a single byte here to make the struct contain something
+    uint8_t byte;
+
+    #endif
+
+    //for C, this is an opaque structure
+
+} SharedMutex;
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief create a new shared mutex
+ * 
+ * @return SharedMutex* a pointer to the new shared mutex
+ */
+SharedMutex* sharedMutex_Create();
+
+/**
+ * @brief destroy a shared mutex
+ * 
+ * @param mut a pointer to the shared mutex to perform the operation on
+ */
+void sharedMutex_Destroy(SharedMutex* mut);
+
+/**
+ * @brief lock a shared mutex exclusively or wait till it is possible
+ * 
+ * @param mut a pointer to the shared mutex to perform the operation on
+ */
+void sharedMutex_Lock(SharedMutex* mut);
+
+/**
+ * @brief unlock an exclusively locked shared mutex
+ * 
+ * @param mut a pointer to the shared mutex to perform the operation on
+ */
+void sharedMutex_Unlock(SharedMutex* mut);
+
+/**
+ * @brief try to lock a shared mutex exclusively
+ * 
+ * @param mut a pointer to the shared mutex to perform the operation on
+ * @return true : the mutex was locked
+ * @return false : failed to lock the mutex -> it is locked
+ */
+bool sharedMutex_Try_lock(SharedMutex* mut);
+
+/**
+ * @brief lock a shared mutex for shared ownership or wait till it is possible
+ * 
+ * @param mut a pointer to the shared mutex to perform the operation on
+ */
+void sharedMutex_Lock_shared(SharedMutex* mut);
+
+/**
+ * @brief release the shared ownership of a shared mutex
+ * 
+ * @param mut a pointer to the shared mutex to perform the operation on
+ */
+void sharedMutex_Unlock_shared(SharedMutex* mut);
+
+/**
+ * @brief try to lock a shared mutex for shared ownership
+ * 
+ * @param mut a pointer to the shared mutex to perform the operation on
+ * @return true : shared ownership was acquired
+ * @return false : failed to lock the mutex -> it is locked exclusively
+ */
+bool sharedMutex_Try_lock_shared(SharedMutex* mut);
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+#endif
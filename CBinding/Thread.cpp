@@ -12,6 +12,318 @@
 //include the thread header
 #include "Thread.h"
 
+//strings are used to keep the name of a starting thread alive
+#include <string>
+#include <cstring>
+//failing to create a thread throws like the C++ thread does
+#include <system_error>
+
+//include the platform thread API
+#if __linux
+#include <sched.h>
+#include <limits.h>
+#include <unistd.h>
+#elif defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+//the handle type of a platform thread
+#if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+typedef HANDLE NativeThreadHandle;
+#else
+typedef pthread_t NativeThreadHandle;
+#endif
+
+/**
+ * @brief restrict the CPUs a platform thread may run on
+ * 
+ * @param handle the handle of the thread
+ * @param mask a bit mask of the allowed CPUs. 0 allows all CPUs.
+ * @return true : the affinity was changed
+ * @return false : failed to change the affinity
+ */
+static bool __threadSetAffinity(NativeThreadHandle handle, uint64_t mask)
+{
+    #if __linux
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (uint32_t i = 0; i < 64; ++i)
+    {
+        //no mask means every CPU is allowed
+        if ((mask == 0) || (mask & (1ull << i))) {CPU_SET(i, &set);}
+    }
+    //without a mask, also allow all CPUs above the 64th
+    if (mask == 0) {for (uint32_t i = 64; i < CPU_SETSIZE; ++i) {CPU_SET(i, &set);}}
+    return pthread_setaffinity_np(handle, sizeof(set), &set) == 0;
+    #elif defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+    //no mask means all CPUs of the process
+    if (mask == 0)
+    {
+        DWORD_PTR process, system;
+        if (!GetProcessAffinityMask(GetCurrentProcess(), &process, &system)) {return false;}
+        mask = process;
+    }
+    return SetThreadAffinityMask(handle, (DWORD_PTR)mask) != 0;
+    #else
+    (void)handle; (void)mask;
+    return false;
+    #endif
+}
+
+/**
+ * @brief change the name of a platform thread
+ * 
+ * @param handle the handle of the thread
+ * @param name the new name
+ * @return true : the name was changed
+ * @return false : failed to change the name
+ */
+static bool __threadSetName(NativeThreadHandle handle, const char* name)
+{
+    if (!name) {return false;}
+    #if __linux
+    //linux limits the name to 15 characters and rejects longer names
+    char shortName[16];
+    strncpy(shortName, name, sizeof(shortName) - 1);
+    shortName[sizeof(shortName) - 1] = 0;
+    return pthread_setname_np(handle, shortName) == 0;
+    #elif defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+    //windows only accepts wide names
+    int length = MultiByteToWideChar(CP_UTF8, 0, name, -1, NULL, 0);
+    if (length <= 0) {return false;}
+    std::wstring wide((size_t)length, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, name, -1, wide.data(), length);
+    return SUCCEEDED(SetThreadDescription(handle, wide.c_str()));
+    #else
+    (void)handle;
+    return false;
+    #endif
+}
+
+/**
+ * @brief change the scheduling of a platform thread
+ * 
+ * @param handle the handle of the thread
+ * @param policy the new scheduling policy
+ * @param priority the new priority
+ * @return true : the scheduling was changed
+ * @return false : failed to change the scheduling
+ */
+static bool __threadSetPriority(NativeThreadHandle handle, ThreadSchedulingPolicy policy, int32_t priority)
+{
+    #if __linux
+    int nativePolicy = SCHED_OTHER;
+    switch (policy)
+    {
+    case GLGE_THREAD_SCHEDULING_FIFO: nativePolicy = SCHED_FIFO; break;
+    case GLGE_THREAD_SCHEDULING_ROUND_ROBIN: nativePolicy = SCHED_RR; break;
+    case GLGE_THREAD_SCHEDULING_BATCH: nativePolicy = SCHED_BATCH; break;
+    case GLGE_THREAD_SCHEDULING_IDLE: nativePolicy = SCHED_IDLE; break;
+    default: break;
+    }
+    //only the real-time policies have a priority
+    sched_param param{};
+    param.sched_priority = ((nativePolicy == SCHED_FIFO) || (nativePolicy == SCHED_RR)) ? priority : 0;
+    return pthread_setschedparam(handle, nativePolicy, &param) == 0;
+    #elif defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+    //windows has no scheduling policies, only the priority is used
+    (void)policy;
+    return SetThreadPriority(handle, priority) != 0;
+    #else
+    (void)handle; (void)policy; (void)priority;
+    return false;
+    #endif
+}
+
+/**
+ * @brief get the handle of the calling thread
+ * 
+ * @return NativeThreadHandle the handle of the calling thread
+ */
+static NativeThreadHandle __threadCurrentHandle()
+{
+    #if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+    return GetCurrentThread();
+    #else
+    return pthread_self();
+    #endif
+}
+
+/**
+ * @brief store everything a thread created with options needs to start
+ */
+struct ThreadStart
+{
+    /**
+     * @brief the function to execute
+     */
+    void (*func)(void*);
+    /**
+     * @brief the data to pass to the function
+     */
+    void* data;
+    /**
+     * @brief the options of the thread
+     */
+    ThreadCreateInfo info;
+    /**
+     * @brief a copy of the name, the name of the info may not outlive the constructor
+     */
+    std::string name;
+};
+
+/**
+ * @brief apply the options of a thread on the thread itself, then run the function
+ * 
+ * @param data a pointer to the thread start information. It is deleted.
+ */
+static void __threadStart(void* data)
+{
+    ThreadStart* start = (ThreadStart*)data;
+    if (start->info.name) {Thread::setCurrentName(start->name.c_str());}
+    if (start->info.affinityMask) {Thread::setCurrentAffinity(start->info.affinityMask);}
+    if ((start->info.policy != GLGE_THREAD_SCHEDULING_DEFAULT) || (start->info.priority != 0))
+    {Thread::setCurrentPriority(start->info.policy, start->info.priority);}
+
+    void (*func)(void*) = start->func;
+    void* funcData = start->data;
+    delete start;
+    (*func)(funcData);
+}
+
+#if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+/**
+ * @brief the entry point of platform threads on windows
+ */
+static DWORD WINAPI __threadNativeMain(LPVOID data) {__threadStart(data); return 0;}
+#else
+/**
+ * @brief the entry point of platform threads on posix systems
+ */
+static void* __threadNativeMain(void* data) {__threadStart(data); return nullptr;}
+#endif
+
+s_Thread::s_Thread(void (*func)(void*), void* data, const ThreadCreateInfo& info)
+{
+    ThreadStart* start = new ThreadStart{func, data, info, info.name ? info.name : ""};
+
+    //the C++ thread can't change the stack size, so only use the platform API if it is needed
+    if (info.stackSize == 0)
+    {
+        thread = std::thread(__threadStart, start);
+        return;
+    }
+
+    #if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+    nativeThread = CreateThread(NULL, (SIZE_T)info.stackSize, __threadNativeMain, start, STACK_SIZE_PARAM_IS_A_RESERVATION, NULL);
+    nativeJoinable = nativeThread != NULL;
+    #else
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    //the stack can't be smaller than the system's minimum and some systems require whole pages
+    uint64_t stackSize = info.stackSize;
+    #ifdef PTHREAD_STACK_MIN
+    stackSize = (stackSize < (uint64_t)PTHREAD_STACK_MIN) ? (uint64_t)PTHREAD_STACK_MIN : stackSize;
+    #endif
+    #ifdef _SC_PAGESIZE
+    long page = sysconf(_SC_PAGESIZE);
+    if (page > 0) {stackSize = (stackSize + (uint64_t)page - 1) / (uint64_t)page * (uint64_t)page;}
+    #endif
+    //a stack size that is still rejected is an error, the thread must not silently get the default stack
+    if (pthread_attr_setstacksize(&attr, (size_t)stackSize) != 0)
+    {
+        pthread_attr_destroy(&attr);
+        delete start;
+        throw std::system_error(std::make_error_code(std::errc::invalid_argument), "invalid thread stack size");
+    }
+    nativeJoinable = pthread_create(&nativeThread, &attr, __threadNativeMain, start) == 0;
+    pthread_attr_destroy(&attr);
+    #endif
+
+    //like the C++ thread, failing to create the thread is fatal
+    if (!nativeJoinable)
+    {
+        delete start;
+        throw std::system_error(std::make_error_code(std::errc::resource_unavailable_try_again), "failed to create a thread");
+    }
+}
+
+void s_Thread::joinNative()
+{
+    #if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+    WaitForSingleObject((HANDLE)nativeThread, INFINITE);
+    CloseHandle((HANDLE)nativeThread);
+    nativeThread = nullptr;
+    #else
+    pthread_join(nativeThread, nullptr);
+    #endif
+    nativeJoinable = false;
+}
+
+void s_Thread::detachNative()
+{
+    #if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+    CloseHandle((HANDLE)nativeThread);
+    nativeThread = nullptr;
+    #else
+    pthread_detach(nativeThread);
+    #endif
+    nativeJoinable = false;
+}
+
+/**
+ * @brief get the platform handle of a thread
+ * 
+ * @param thread the thread to get the handle from
+ * @param handle filled with the handle
+ * @return true : the thread is running and has a handle
+ * @return false : the thread has no handle
+ */
+static bool __threadHandle(s_Thread& thread, NativeThreadHandle& handle)
+{
+    if (thread.nativeJoinable) {handle = (NativeThreadHandle)thread.nativeThread; return true;}
+    if (!thread.thread.joinable()) {return false;}
+    handle = (NativeThreadHandle)thread.thread.native_handle();
+    return true;
+}
+
+bool s_Thread::setAffinity(uint64_t mask)
+{
+    NativeThreadHandle handle;
+    return __threadHandle(*this, handle) && __threadSetAffinity(handle, mask);
+}
+
+bool s_Thread::setName(const char* name)
+{
+    NativeThreadHandle handle;
+    return __threadHandle(*this, handle) && __threadSetName(handle, name);
+}
+
+bool s_Thread::setPriority(ThreadSchedulingPolicy policy, int32_t priority)
+{
+    NativeThreadHandle handle;
+    return __threadHandle(*this, handle) && __threadSetPriority(handle, policy, priority);
+}
+
+bool s_Thread::setCurrentAffinity(uint64_t mask) {return __threadSetAffinity(__threadCurrentHandle(), mask);}
+
+bool s_Thread::setCurrentName(const char* name) {return __threadSetName(__threadCurrentHandle(), name);}
+
+bool s_Thread::setCurrentPriority(ThreadSchedulingPolicy policy, int32_t priority) {return __threadSetPriority(__threadCurrentHandle(), policy, priority);}
+
+int32_t s_Thread::currentCpu()
+{
+    #if __linux
+    return (int32_t)sched_getcpu();
+    #elif defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+    return (int32_t)GetCurrentProcessorNumber();
+    #else
+    return -1;
+    #endif
+}
+
 Thread* thread_Create(void (*func)(void*), void* data) {return new Thread(func, data);}
 
 void thread_Destroy(Thread* thread) {delete thread;}
@@ -25,3 +337,19 @@ bool thread_Joinable(Thread* thread) {return thread->joinable();}
 void thread_Swap(Thread* thread, Thread* other) {thread->swap(other);}
 
 unsigned int thread_Hardware_concurrency() {return Thread::hardware_concurrency();}
+
+Thread* thread_CreateWithInfo(void (*func)(void*), void* data, const ThreadCreateInfo* info) {return new Thread(func, data, *info);}
+
+bool thread_SetAffinity(uint64_t mask, Thread* thread) {return thread->setAffinity(mask);}
+
+bool thread_SetName(const char* name, Thread* thread) {return thread->setName(name);}
+
+bool thread_SetPriority(ThreadSchedulingPolicy policy, int32_t priority, Thread* thread) {return thread->setPriority(policy, priority);}
+
+bool thread_SetCurrentAffinity(uint64_t mask) {return Thread::setCurrentAffinity(mask);}
+
+bool thread_SetCurrentName(const char* name) {return Thread::setCurrentName(name);}
+
+bool thread_SetCurrentPriority(ThreadSchedulingPolicy policy, int32_t priority) {return Thread::setCurrentPriority(policy, priority);}
+
+int32_t thread_GetCurrentCpu() {return Thread::currentCpu();}
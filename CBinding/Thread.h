@@ -17,6 +17,68 @@
 #if __cplusplus
 #include <thread>
 #endif
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+//threads with a custom stack size are created through the platform API
+#if __cplusplus && !(defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__))
+#include <pthread.h>
+#endif
+
+/**
+ * @brief define the scheduling policies a thread can use
+ */
+typedef enum e_ThreadSchedulingPolicy {
+    /**
+     * @brief the default time sharing policy of the operating system
+     */
+    GLGE_THREAD_SCHEDULING_DEFAULT = 0,
+    /**
+     * @brief real-time first-in first-out scheduling (SCHED_FIFO). Usually needs elevated rights.
+     */
+    GLGE_THREAD_SCHEDULING_FIFO,
+    /**
+     * @brief real-time round-robin scheduling (SCHED_RR). Usually needs elevated rights.
+     */
+    GLGE_THREAD_SCHEDULING_ROUND_ROBIN,
+    /**
+     * @brief scheduling for CPU-heavy, non-interactive threads (SCHED_BATCH)
+     */
+    GLGE_THREAD_SCHEDULING_BATCH,
+    /**
+     * @brief scheduling for threads that should only run if nothing else wants to (SCHED_IDLE)
+     */
+    GLGE_THREAD_SCHEDULING_IDLE
+} ThreadSchedulingPolicy;
+
+/**
+ * @brief store the options a thread can be created with. A zero-initialized structure creates a default thread.
+ */
+typedef struct s_ThreadCreateInfo {
+    /**
+     * @brief the name of the thread or NULL. Linux only keeps the first 15 characters.
+     */
+    const char* name;
+    /**
+     * @brief a bit mask of the CPUs the thread may run on. Bit i means CPU i. 0 means no restriction.
+     */
+    uint64_t affinityMask;
+    /**
+     * @brief the scheduling policy of the thread. Not supported on Windows.
+     */
+    ThreadSchedulingPolicy policy;
+    /**
+     * @brief the priority of the thread. On Linux only used by the real-time policies (1 - 99), on Windows this is a THREAD_PRIORITY_* value.
+     */
+    int32_t priority;
+    /**
+     * @brief the size of the thread's stack in bytes. 0 means the default size. Raised to the system's minimum and
+     * rounded up to whole pages. A size the system still rejects makes the creation fail like a failed thread creation.
+     */
+    uint64_t stackSize;
+} ThreadCreateInfo;
 
 /**
  * @brief store a wrapper around a C++ thread object for C
@@ -39,22 +101,34 @@ typedef struct s_Thread {
      */
     s_Thread(void (*func)(void*), void* data) : thread(std::thread(func, data)) {}
 
+    /**
+     * @brief Construct a new Thread with specific options
+     * 
+     * The name, affinity and scheduling options are applied by the new thread itself before the function is called. Options that
+     * can't be applied (e.g. real-time scheduling without the required rights) are ignored.
+     * 
+     * @param func a function pointer to the function to execute in the other thread
+     * @param data a pointer to the data to pass to the function
+     * @param info the options to create the thread with
+     */
+    s_Thread(void (*func)(void*), void* data, const ThreadCreateInfo& info);
+
     /**
      * @brief Destroy the Thread
      * 
      * If the thread isn't joined, this joins the thread
      */
-    ~s_Thread() {if (thread.joinable()) {thread.join();}}
+    ~s_Thread() {if (joinable()) {join();}}
 
     /**
      * @brief join the thread back to the calling thread
      */
-    inline void join() {thread.join();}
+    inline void join() {if (nativeJoinable) {joinNative();} else {thread.join();}}
 
     /**
      * @brief detach the thread from the calling thread
      */
-    inline void detach() {thread.detach();}
+    inline void detach() {if (nativeJoinable) {detachNative();} else {thread.detach();}}
 
     /**
      * @brief get if the thread can be joined
@@ -62,14 +136,82 @@ typedef struct s_Thread {
      * @return true : the thread can be joined | 
      * @return false : the thread cannot be joined
      */
-    inline bool joinable() {return thread.joinable();}
+    inline bool joinable() {return nativeJoinable || thread.joinable();}
 
     /**
      * @brief swap the threads that are being executed
      * 
      * @param other a pointer to the other thread to swap with
      */
-    inline void swap(s_Thread* other) {thread.swap(other->thread);}
+    inline void swap(s_Thread* other)
+    {
+        thread.swap(other->thread);
+        std::swap(nativeThread, other->nativeThread);
+        std::swap(nativeJoinable, other->nativeJoinable);
+    }
+
+    /**
+     * @brief restrict the CPUs the thread may run on
+     * 
+     * @param mask a bit mask of the allowed CPUs. Bit i means CPU i. 0 allows all CPUs.
+     * @return true : the affinity was changed
+     * @return false : failed to change the affinity
+     */
+    bool setAffinity(uint64_t mask);
+
+    /**
+     * @brief change the name of the thread as shown by debuggers and profilers
+     * 
+     * @param name the new name of the thread
+     * @return true : the name was changed
+     * @return false : failed to change the name
+     */
+    bool setName(const char* name);
+
+    /**
+     * @brief change the scheduling policy and priority of the thread
+     * 
+     * @param policy the new scheduling policy
+     * @param priority the new priority
+     * @return true : the scheduling was changed
+     * @return false : failed to change the scheduling (e.g. missing rights)
+     */
+    bool setPriority(ThreadSchedulingPolicy policy, int32_t priority);
+
+    /**
+     * @brief restrict the CPUs the calling thread may run on
+     * 
+     * @param mask a bit mask of the allowed CPUs. Bit i means CPU i. 0 allows all CPUs.
+     * @return true : the affinity was changed
+     * @return false : failed to change the affinity
+     */
+    static bool setCurrentAffinity(uint64_t mask);
+
+    /**
+     * @brief change the name of the calling thread
+     * 
+     * @param name the new name of the thread
+     * @return true : the name was changed
+     * @return false : failed to change the name
+     */
+    static bool setCurrentName(const char* name);
+
+    /**
+     * @brief change the scheduling policy and priority of the calling thread
+     * 
+     * @param policy the new scheduling policy
+     * @param priority the new priority
+     * @return true : the scheduling was changed
+     * @return false : failed to change the scheduling (e.g. missing rights)
+     */
+    static bool setCurrentPriority(ThreadSchedulingPolicy policy, int32_t priority);
+
+    /**
+     * @brief get the CPU the calling thread is currently running on
+     * 
+     * @return int32_t the index of the CPU or -1 if it is unknown
+     */
+    static int32_t currentCpu();
 
     /**
      * @brief get an ESTIMATION on the amount of present hardware threads
@@ -78,6 +220,31 @@ typedef struct s_Thread {
      */
     static inline unsigned int hardware_concurrency() {return std::thread::hardware_concurrency();}
 
+    /**
+     * @brief store the platform thread if the thread was created with a custom stack size. The C++ thread can't do that.
+     */
+    #if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+    void* nativeThread = nullptr;
+    #else
+    pthread_t nativeThread{};
+    #endif
+    /**
+     * @brief true if the platform thread is used and can be joined
+     */
+    bool nativeJoinable = false;
+
+protected:
+
+    /**
+     * @brief join the platform thread
+     */
+    void joinNative();
+
+    /**
+     * @brief detach the platform thread
+     */
+    void detachNative();
+
     #else
 
     //for windows, add a single byte here to make the struct contain something
@@ -102,6 +269,16 @@ extern "C" {
  */
 Thread* thread_Create(void (*func)(void*), void* data);
 
+/**
+ * @brief create a thread with specific options that executes the given function with the given parameters
+ * 
+ * @param func the function to execute on the different thread
+ * @param data the data given to the function
+ * @param info the options to create the thread with
+ * @return Thread* a pointer to the thread that stores the function
+ */
+Thread* thread_CreateWithInfo(void (*func)(void*), void* data, const ThreadCreateInfo* info);
+
 /**
  * @brief destroy a thread
  * 
@@ -149,6 +326,72 @@ void thread_Swap(Thread* thread, Thread* other);
  */
 unsigned int thread_Hardware_concurrency();
 
+/**
+ * @brief restrict the CPUs a thread may run on
+ * 
+ * @param mask a bit mask of the allowed CPUs. Bit i means CPU i. 0 allows all CPUs.
+ * @param thread a pointer to the thread to change
+ * @return true : the affinity was changed
+ * @return false : failed to change the affinity
+ */
+bool thread_SetAffinity(uint64_t mask, Thread* thread);
+
+/**
+ * @brief change the name of a thread
+ * 
+ * @param name the new name of the thread
+ * @param thread a pointer to the thread to change
+ * @return true : the name was changed
+ * @return false : failed to change the name
+ */
+bool thread_SetName(const char* name, Thread* thread);
+
+/**
+ * @brief change the scheduling policy and priority of a thread
+ * 
+ * @param policy the new scheduling policy
+ * @param priority the new priority
+ * @param thread a pointer to the thread to change
+ * @return true : the scheduling was changed
+ * @return false : failed to change the scheduling
+ */
+bool thread_SetPriority(ThreadSchedulingPolicy policy, int32_t priority, Thread* thread);
+
+/**
+ * @brief restrict the CPUs the calling thread may run on
+ * 
+ * @param mask a bit mask of the allowed CPUs. Bit i means CPU i. 0 allows all CPUs.
+ * @return true : the affinity was changed
+ * @return false : failed to change the affinity
+ */
+bool thread_SetCurrentAffinity(uint64_t mask);
+
+/**
+ * @brief change the name of the calling thread
+ * 
+ * @param name the new name of the thread
+ * @return true : the name was changed
+ * @return false : failed to change the name
+ */
+bool thread_SetCurrentName(const char* name);
+
+/**
+ * @brief change the scheduling policy and priority of the calling thread
+ * 
+ * @param policy the new scheduling policy
+ * @param priority the new priority
+ * @return true : the scheduling was changed
+ * @return false : failed to change the scheduling
+ */
+bool thread_SetCurrentPriority(ThreadSchedulingPolicy policy, int32_t priority);
+
+/**
+ * @brief get the CPU the calling thread is currently running on
+ * 
+ * @return int32_t the index of the CPU or -1 if it is unknown
+ */
+int32_t thread_GetCurrentCpu();
+
 //the the extern section in C++
 #if __cplusplus
 }
@@ -0,0 +1,585 @@
+/**
+ * @file BinaryLog.cpp
+ * @author DM8AT
+ * @brief implement deferred log records and the binary log file format
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include binary logs
+#include "BinaryLog.h"
+
+//memory management stuff
+#include <cstring>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <chrono>
+
+/**
+ * @brief store a single conversion of a printf format string
+ */
+struct LogFormatSpec
+{
+    /**
+     * @brief the first character of the conversion (the '%')
+     */
+    const char* begin = nullptr;
+    /**
+     * @brief the character after the conversion
+     */
+    const char* end = nullptr;
+    /**
+     * @brief the flags, width and precision of the conversion
+     */
+    std::string options;
+    /**
+     * @brief the conversion character
+     */
+    char conversion = 0;
+    /**
+     * @brief the amount of '*' in the width and precision. Each one takes an int argument.
+     */
+    uint8_t stars = 0;
+    /**
+     * @brief the type the value of the conversion is stored as or 0 if the conversion has no value
+     */
+    uint8_t type = 0;
+    /**
+     * @brief the length modifier for 32 bit integers (hh or h) or empty, null terminated
+     */
+    char shortLength[3] = {0, 0, 0};
+    /**
+     * @brief true if the value is consumed, but can't be formatted (wide characters and strings). It is reported as missing.
+     */
+    bool unsupported = false;
+};
+
+/**
+ * @brief find the next conversion of a format string. "%%" is not a conversion.
+ * 
+ * @param format the position in the format string to start searching at
+ * @param spec filled with the conversion
+ * @return true : a conversion was found
+ * @return false : the format string has no more conversions
+ */
+static bool __logNextSpec(const char* format, LogFormatSpec& spec)
+{
+    const char* c = format;
+    while (*c)
+    {
+        if (*c != '%') {++c; continue;}
+        if (c[1] == '%') {c += 2; continue;}
+
+        spec = LogFormatSpec();
+        spec.begin = c++;
+        //flags, width and precision
+        while (*c && strchr("-+ #0'", *c)) {spec.options += *c++;}
+        if (*c == '*') {spec.options += *c++; ++spec.stars;}
+        while ((*c >= '0') && (*c <= '9')) {spec.options += *c++;}
+        if (*c == '.')
+        {
+            spec.options += *c++;
+            if (*c == '*') {spec.options += *c++; ++spec.stars;}
+            while ((*c >= '0') && (*c <= '9')) {spec.options += *c++;}
+        }
+
+        //the length modifier decides how large integers are
+        bool is64 = false;
+        bool isLong = false;
+        bool isLongDouble = false;
+        if ((c[0] == 'h') && (c[1] == 'h')) {spec.shortLength[0] = spec.shortLength[1] = 'h'; c += 2;}
+        else if (c[0] == 'h') {spec.shortLength[0] = 'h'; ++c;}
+        else if ((c[0] == 'l') && (c[1] == 'l')) {is64 = true; c += 2;}
+        else if (c[0] == 'l') {is64 = (sizeof(long) == 8); isLong = true; ++c;}
+        else if (c[0] == 'z') {is64 = (sizeof(size_t) == 8); ++c;}
+        else if (c[0] == 't') {is64 = (sizeof(ptrdiff_t) == 8); ++c;}
+        else if ((c[0] == 'j') || (c[0] == 'q')) {is64 = true; ++c;}
+        else if (c[0] == 'L') {isLongDouble = true; ++c;}
+
+        spec.conversion = *c;
+        if (*c) {++c;}
+        spec.end = c;
+
+        switch (spec.conversion)
+        {
+        case 'd': case 'i': case 'u': case 'o': case 'x': case 'X':
+            spec.type = is64 ? GLGE_LOG_ARG_INT64 : GLGE_LOG_ARG_INT32;
+            break;
+        case 'c':
+            //a wint_t is promoted to int like a char, but can't be printed as narrow character
+            spec.type = GLGE_LOG_ARG_INT32;
+            spec.unsupported = isLong;
+            break;
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+            spec.type = isLongDouble ? GLGE_LOG_ARG_LONG_DOUBLE : GLGE_LOG_ARG_DOUBLE;
+            break;
+        case 's':
+            //wide strings are only consumed as pointer, so the following arguments stay in place
+            spec.type = isLong ? GLGE_LOG_ARG_POINTER : GLGE_LOG_ARG_STRING;
+            spec.unsupported = isLong;
+            break;
+        case 'p':
+            spec.type = GLGE_LOG_ARG_POINTER;
+            break;
+        default:
+            //unsupported conversions (like %n) take no value
+            spec.type = 0;
+            break;
+        }
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief get the amount of bytes an argument type needs, strings without their characters
+ * 
+ * @param type the type of the argument
+ * @return uint16_t the size in bytes
+ */
+static uint16_t __logArgSize(uint8_t type)
+{
+    switch (type)
+    {
+    case GLGE_LOG_ARG_INT32: return 4;
+    case GLGE_LOG_ARG_STRING: return 2;
+    default: return 8;
+    }
+}
+
+/**
+ * @brief store all registered call sites
+ */
+struct LogCallSiteRegistry
+{
+    /**
+     * @brief protects the call sites
+     */
+    std::mutex mutex;
+    /**
+     * @brief the call sites, the identifier is the index plus one
+     */
+    std::vector<LogCallSite*> sites;
+};
+
+/**
+ * @brief get the registry of all call sites. It is never destroyed, so it can be used on exit.
+ * 
+ * @return LogCallSiteRegistry& a reference to the registry
+ */
+static LogCallSiteRegistry& __logCallSites()
+{
+    static LogCallSiteRegistry* registry = new LogCallSiteRegistry;
+    return *registry;
+}
+
+BinaryLogWriter::BinaryLogWriter(const char* path)
+{
+    m_file = fopen(path, "wb");
+    if (!m_file) {return;}
+    //write in large blocks
+    setvbuf(m_file, nullptr, _IOFBF, 1 << 16);
+    fwrite(GLGE_BINARY_LOG_MAGIC, 1, 8, m_file);
+}
+
+BinaryLogWriter::~BinaryLogWriter()
+{
+    if (m_file) {fclose(m_file);}
+}
+
+void BinaryLogWriter::write(const LogRecord& record)
+{
+    if (!m_file) {return;}
+
+    //text messages are stored as they are
+    if (record.site == 0)
+    {
+        uint8_t kind = 3;
+        uint64_t size;
+        const char* text = logRecord_Text(&size, &record);
+        uint32_t length = (uint32_t)size;
+        fwrite(&kind, 1, 1, m_file);
+        fwrite(&record.timestamp, 8, 1, m_file);
+        fwrite(&length, 4, 1, m_file);
+        fwrite(text, 1, length, m_file);
+        return;
+    }
+
+    //write the call site before its first call
+    if (record.site >= m_sites.size()) {m_sites.resize(record.site + 1, false);}
+    if (!m_sites[record.site])
+    {
+        const LogCallSite* site = logCallSite_Get(record.site);
+        const char* file = (site && site->file) ? site->file : "";
+        const char* format = (site && site->format) ? site->format : "";
+        uint8_t kind = 1;
+        uint32_t line = site ? site->line : 0;
+        uint8_t level = site ? site->level : 0;
+        uint16_t formatLength = (uint16_t)strnlen(format, UINT16_MAX);
+        uint16_t fileLength = (uint16_t)strnlen(file, UINT16_MAX);
+        fwrite(&kind, 1, 1, m_file);
+        fwrite(&record.site, 4, 1, m_file);
+        fwrite(&line, 4, 1, m_file);
+        fwrite(&level, 1, 1, m_file);
+        fwrite(&formatLength, 2, 1, m_file);
+        fwrite(format, 1, formatLength, m_file);
+        fwrite(&fileLength, 2, 1, m_file);
+        fwrite(file, 1, fileLength, m_file);
+        m_sites[record.site] = true;
+    }
+
+    uint8_t kind = 2;
+    fwrite(&kind, 1, 1, m_file);
+    fwrite(&record.site, 4, 1, m_file);
+    fwrite(&record.timestamp, 8, 1, m_file);
+    fwrite(&record.argBytes, 2, 1, m_file);
+    fwrite(record.data.args, 1, record.argBytes, m_file);
+}
+
+void BinaryLogWriter::flush()
+{
+    if (m_file) {fflush(m_file);}
+}
+
+/**
+ * @brief append a single formatted value to a string
+ * 
+ * @tparam T the type of the value
+ * @param out the string to append to
+ * @param spec the conversion to format the value with
+ * @param stars the values for the '*' of the conversion
+ * @param value the value to format
+ */
+template <typename T>
+static void __logAppend(String& out, const std::string& spec, const int* stars, uint8_t starCount, T value)
+{
+    char local[256];
+    int length;
+    if (starCount == 0) {length = snprintf(local, sizeof(local), spec.c_str(), value);}
+    else if (starCount == 1) {length = snprintf(local, sizeof(local), spec.c_str(), stars[0], value);}
+    else {length = snprintf(local, sizeof(local), spec.c_str(), stars[0], stars[1], value);}
+    if (length < 0) {return;}
+    if ((size_t)length < sizeof(local)) {out.append(local, (size_t)length); return;}
+
+    //the text did not fit, format it again directly into the string
+    size_t start = out.size();
+    out.resize(start + (size_t)length + 1);
+    if (starCount == 0) {snprintf(out.data() + start, (size_t)length + 1, spec.c_str(), value);}
+    else if (starCount == 1) {snprintf(out.data() + start, (size_t)length + 1, spec.c_str(), stars[0], value);}
+    else {snprintf(out.data() + start, (size_t)length + 1, spec.c_str(), stars[0], stars[1], value);}
+    out.resize(start + (size_t)length);
+}
+
+extern "C" {
+
+uint32_t logCallSite_Register(LogCallSite* site, const char* format)
+{
+    LogCallSiteRegistry& registry = __logCallSites();
+    std::lock_guard<std::mutex> guard(registry.mutex);
+    //another thread may have been faster
+    uint32_t id = atomic32_Load(GLGE_ATOMIC_RELAXED, &site->id);
+    if (id != 0) {return id;}
+
+    //store the types of all arguments the format string needs
+    site->format = format ? format : "";
+    site->argCount = 0;
+    site->fixedBytes = 0;
+    LogFormatSpec spec;
+    const char* c = site->format;
+    while (__logNextSpec(c, spec))
+    {
+        c = spec.end;
+        for (uint8_t i = 0; i < spec.stars + ((spec.type != 0) ? 1 : 0); ++i)
+        {
+            uint8_t type = (i < spec.stars) ? (uint8_t)GLGE_LOG_ARG_INT32 : spec.type;
+            //arguments that don't fit anymore are reported as missing when formatting
+            if ((site->argCount == GLGE_LOG_MAX_ARGS) || (site->fixedBytes + __logArgSize(type) > GLGE_LOG_RECORD_ARG_BYTES)) {break;}
+            site->argTypes[site->argCount++] = type;
+            site->fixedBytes += __logArgSize(type);
+        }
+    }
+
+    registry.sites.push_back(site);
+    id = (uint32_t)registry.sites.size();
+    atomic32_Store(id, GLGE_ATOMIC_RELEASE, &site->id);
+    return id;
+}
+
+const LogCallSite* logCallSite_Get(uint32_t id)
+{
+    LogCallSiteRegistry& registry = __logCallSites();
+    std::lock_guard<std::mutex> guard(registry.mutex);
+    return ((id == 0) || (id > registry.sites.size())) ? nullptr : registry.sites[id - 1];
+}
+
+void logRecord_Encode(const LogCallSite* site, va_list args, LogRecord* record)
+{
+    uint8_t* out = record->data.args;
+    //the bytes left for the characters of strings
+    uint32_t budget = GLGE_LOG_RECORD_ARG_BYTES - site->fixedBytes;
+
+    for (uint8_t i = 0; i < site->argCount; ++i)
+    {
+        switch (site->argTypes[i])
+        {
+        case GLGE_LOG_ARG_INT32:
+            {int32_t v = (int32_t)va_arg(args, int); memcpy(out, &v, 4); out += 4;}
+            break;
+        case GLGE_LOG_ARG_INT64:
+            {int64_t v = (int64_t)va_arg(args, long long); memcpy(out, &v, 8); out += 8;}
+            break;
+        case GLGE_LOG_ARG_DOUBLE:
+            {double v = va_arg(args, double); memcpy(out, &v, 8); out += 8;}
+            break;
+        case GLGE_LOG_ARG_LONG_DOUBLE:
+            {double v = (double)va_arg(args, long double); memcpy(out, &v, 8); out += 8;}
+            break;
+        case GLGE_LOG_ARG_POINTER:
+            {uint64_t v = (uint64_t)(uintptr_t)va_arg(args, void*); memcpy(out, &v, 8); out += 8;}
+            break;
+        case GLGE_LOG_ARG_STRING:
+            {
+                const char* str = va_arg(args, const char*);
+                str = str ? str : "(null)";
+                //cut the string if the record is full
+                size_t length = strnlen(str, budget);
+                uint16_t stored = (uint16_t)length;
+                budget -= stored;
+                memcpy(out, &stored, 2);
+                memcpy(out + 2, str, stored);
+                out += 2 + stored;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    record->argBytes = (uint16_t)(out - record->data.args);
+}
+
+void logRecord_Format(const char* format, const uint8_t* args, uint16_t argBytes, String* out)
+{
+    const uint8_t* arg = args;
+    const uint8_t* argEnd = args + argBytes;
+    const char* c = format;
+    LogFormatSpec spec;
+
+    while (true)
+    {
+        //copy the text up to the next conversion, turning "%%" into "%"
+        const char* next = __logNextSpec(c, spec) ? spec.begin : c + strlen(c);
+        for (const char* t = c; t < next; ++t)
+        {
+            out->push_back(*t);
+            if ((t[0] == '%') && (t + 1 < next) && (t[1] == '%')) {++t;}
+        }
+        if (!*next) {return;}
+        c = spec.end;
+
+        //conversions without a value are skipped
+        if (spec.type == 0) {continue;}
+
+        //read the values of the '*'s
+        int stars[2] = {0, 0};
+        bool missing = false;
+        for (uint8_t i = 0; i < spec.stars; ++i)
+        {
+            if (arg + 4 > argEnd) {missing = true; break;}
+            int32_t v;
+            memcpy(&v, arg, 4);
+            arg += 4;
+            stars[i] = v;
+        }
+
+        //values that can't be formatted are skipped and reported as missing
+        if (spec.unsupported)
+        {
+            arg += __logArgSize(spec.type);
+            out->append("<missing>");
+            continue;
+        }
+
+        //the conversion with the length modifier of the stored type
+        std::string conversion = "%" + spec.options;
+        bool isUnsigned = strchr("uoxX", spec.conversion) != nullptr;
+        switch (spec.type)
+        {
+        case GLGE_LOG_ARG_INT32:
+            {
+                if (missing || (arg + 4 > argEnd)) {missing = true; break;}
+                int32_t v;
+                memcpy(&v, arg, 4);
+                arg += 4;
+                conversion += spec.shortLength;
+                conversion += spec.conversion;
+                if (isUnsigned) {__logAppend(*out, conversion, stars, spec.stars, (unsigned int)v);}
+                else {__logAppend(*out, conversion, stars, spec.stars, (int)v);}
+            }
+            break;
+        case GLGE_LOG_ARG_INT64:
+            {
+                if (missing || (arg + 8 > argEnd)) {missing = true; break;}
+                int64_t v;
+                memcpy(&v, arg, 8);
+                arg += 8;
+                conversion += std::string("ll") + spec.conversion;
+                if (isUnsigned) {__logAppend(*out, conversion, stars, spec.stars, (unsigned long long)v);}
+                else {__logAppend(*out, conversion, stars, spec.stars, (long long)v);}
+            }
+            break;
+        case GLGE_LOG_ARG_DOUBLE:
+        case GLGE_LOG_ARG_LONG_DOUBLE:
+            {
+                if (missing || (arg + 8 > argEnd)) {missing = true; break;}
+                double v;
+                memcpy(&v, arg, 8);
+                arg += 8;
+                conversion += spec.conversion;
+                __logAppend(*out, conversion, stars, spec.stars, v);
+            }
+            break;
+        case GLGE_LOG_ARG_POINTER:
+            {
+                if (missing || (arg + 8 > argEnd)) {missing = true; break;}
+                uint64_t v;
+                memcpy(&v, arg, 8);
+                arg += 8;
+                conversion += spec.conversion;
+                __logAppend(*out, conversion, stars, spec.stars, (void*)(uintptr_t)v);
+            }
+            break;
+        case GLGE_LOG_ARG_STRING:
+            {
+                uint16_t length;
+                if (missing || (arg + 2 > argEnd)) {missing = true; break;}
+                memcpy(&length, arg, 2);
+                if (arg + 2 + length > argEnd) {missing = true; break;}
+                std::string str((const char*)arg + 2, length);
+                arg += 2 + length;
+                conversion += spec.conversion;
+                __logAppend(*out, conversion, stars, spec.stars, str.c_str());
+            }
+            break;
+        default:
+            break;
+        }
+        if (missing) {out->append("<missing>");}
+    }
+}
+
+void logRecord_SetText(const char* text, uint64_t length, LogLevel level, LogRecord* record)
+{
+    record->site = 0;
+    record->flags = (uint16_t)level & GLGE_LOG_RECORD_LEVEL_MASK;
+    //short text lives in the record, so the common case needs no allocation on the logging thread
+    if (length <= GLGE_LOG_RECORD_ARG_BYTES)
+    {
+        record->argBytes = (uint16_t)length;
+        memcpy(record->data.args, text, (size_t)length);
+        return;
+    }
+    record->argBytes = 0;
+    record->flags |= GLGE_LOG_RECORD_HEAP_TEXT;
+    record->data.text = new String(text, length);
+}
+
+const char* logRecord_Text(uint64_t* length, const LogRecord* record)
+{
+    if (record->flags & GLGE_LOG_RECORD_HEAP_TEXT)
+    {
+        *length = record->data.text->size();
+        return record->data.text->data();
+    }
+    *length = record->argBytes;
+    return (const char*)record->data.args;
+}
+
+void logRecord_Release(const LogRecord* record)
+{
+    if ((record->site == 0) && (record->flags & GLGE_LOG_RECORD_HEAP_TEXT)) {delete record->data.text;}
+}
+
+uint64_t logRecord_Now()
+{return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();}
+
+bool binaryLog_Decode(const char* path, void (*func)(String* line))
+{
+    FILE* file = fopen(path, "rb");
+    if (!file) {return false;}
+    char magic[8];
+    if ((fread(magic, 1, 8, file) != 8) || (memcmp(magic, GLGE_BINARY_LOG_MAGIC, 8) != 0)) {fclose(file); return false;}
+
+    //the formats and levels of the call sites, the index is the identifier
+    std::vector<std::string> formats;
+    std::vector<uint8_t> levels;
+    std::string buffer;
+    String line;
+    uint8_t kind;
+
+    //read a value and stop at the end of the file
+    auto read = [&](void* data, size_t size) {return fread(data, 1, size, file) == size;};
+    //start a line with the timestamp
+    auto prefix = [&](uint64_t timestamp) {
+        char stamp[48];
+        snprintf(stamp, sizeof(stamp), "[%llu.%09llu] ", (unsigned long long)(timestamp / 1000000000ull), (unsigned long long)(timestamp % 1000000000ull));
+        line = stamp;
+    };
+
+    while (read(&kind, 1))
+    {
+        if (kind == 1)
+        {
+            uint32_t id, lineNumber;
+            uint8_t level;
+            uint16_t length;
+            if (!read(&id, 4) || !read(&lineNumber, 4) || !read(&level, 1) || !read(&length, 2)) {break;}
+            buffer.resize(length);
+            if (!read(buffer.data(), length)) {break;}
+            if (id >= formats.size()) {formats.resize(id + 1); levels.resize(id + 1);}
+            formats[id] = buffer;
+            levels[id] = level;
+            //the file name is not needed for the text
+            if (!read(&length, 2)) {break;}
+            buffer.resize(length);
+            if (!read(buffer.data(), length)) {break;}
+        }
+        else if (kind == 2)
+        {
+            uint32_t id;
+            uint64_t timestamp;
+            uint16_t argBytes;
+            uint8_t args[GLGE_LOG_RECORD_ARG_BYTES];
+            if (!read(&id, 4) || !read(&timestamp, 8) || !read(&argBytes, 2) || (argBytes > sizeof(args)) || !read(args, argBytes)) {break;}
+            prefix(timestamp);
+            if (id < formats.size())
+            {
+                line += logLevel_Prefix((LogLevel)levels[id]);
+                logRecord_Format(formats[id].c_str(), args, argBytes, &line);
+            }
+            else {line += "<unknown call site>";}
+            (*func)(&line);
+        }
+        else if (kind == 3)
+        {
+            uint64_t timestamp;
+            uint32_t length;
+            if (!read(&timestamp, 8) || !read(&length, 4)) {break;}
+            buffer.resize(length);
+            if (!read(buffer.data(), length)) {break;}
+            prefix(timestamp);
+            line += buffer;
+            (*func)(&line);
+        }
+        //an unknown kind means the file is broken
+        else {break;}
+    }
+
+    fclose(file);
+    return true;
+}
+
+}
@@ -0,0 +1,335 @@
+/**
+ * @file BinaryLog.h
+ * @author DM8AT
+ * @brief define log records with deferred formatting and the binary log file format
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_BG_BINARY_LOG_
+#define _GLGE_BG_BINARY_LOG_
+
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+//the arguments are passed as variadic arguments
+#include <stdarg.h>
+//the call site identifiers are assigned atomically
+#include "../../CBinding/Atomic.h"
+//records are formatted into strings
+#include "../../CBinding/String.h"
+//call sites store the level of their messages
+#include "LogLevel.h"
+
+//the writer needs files and containers in C++
+#if __cplusplus
+#include <cstdio>
+#include <vector>
+#endif
+
+/**
+ * @brief the maximum amount of arguments a deferred log call can have
+ */
+#define GLGE_LOG_MAX_ARGS 16
+/**
+ * @brief the amount of bytes a log record has for its arguments. Longer string arguments are cut.
+ */
+#define GLGE_LOG_RECORD_ARG_BYTES 112
+/**
+ * @brief the magic bytes at the start of a binary log file
+ */
+#define GLGE_BINARY_LOG_MAGIC "GLGELOG1"
+
+/**
+ * @brief define the types the arguments of a deferred log call are stored as
+ */
+typedef enum e_LogArgType {
+    /**
+     * @brief a 32 bit integer (int, unsigned int, char, short)
+     */
+    GLGE_LOG_ARG_INT32 = 1,
+    /**
+     * @brief a 64 bit integer (long, long long, size_t, ...)
+     */
+    GLGE_LOG_ARG_INT64,
+    /**
+     * @brief a floating point number, stored as double
+     */
+    GLGE_LOG_ARG_DOUBLE,
+    /**
+     * @brief a string. The characters are copied, stored as a 16 bit length and the characters.
+     */
+    GLGE_LOG_ARG_STRING,
+    /**
+     * @brief a pointer, stored as 64 bit integer
+     */
+    GLGE_LOG_ARG_POINTER,
+    /**
+     * @brief a long double, stored as double
+     */
+    GLGE_LOG_ARG_LONG_DOUBLE
+} LogArgType;
+
+/**
+ * @brief store the static information about a deferred log call. One exists per call, see GLGE_LOG_DEFERRED.
+ */
+typedef struct s_LogCallSite {
+    /**
+     * @brief the file the call is in
+     */
+    const char* file;
+    /**
+     * @brief the line the call is in
+     */
+    uint32_t line;
+    /**
+     * @brief the LogLevel of the messages of the call. Their text is prefixed with the level.
+     */
+    uint8_t level;
+    /**
+     * @brief the printf style format string. Set once the call site is registered.
+     */
+    const char* format;
+    /**
+     * @brief the identifier of the call site or 0 if it is not registered yet
+     */
+    Atomic32 id;
+    /**
+     * @brief the amount of arguments the format string needs
+     */
+    uint8_t argCount;
+    /**
+     * @brief the types of the arguments
+     */
+    uint8_t argTypes[GLGE_LOG_MAX_ARGS];
+    /**
+     * @brief the amount of bytes all arguments except for the strings need
+     */
+    uint16_t fixedBytes;
+} LogCallSite;
+
+/**
+ * @brief the bits of LogRecord::flags that store the level of a text message
+ */
+#define GLGE_LOG_RECORD_LEVEL_MASK 0x00FF
+
+/**
+ * @brief set in LogRecord::flags if the text of a text message did not fit into the record and is stored on the heap
+ */
+#define GLGE_LOG_RECORD_HEAP_TEXT 0x0100
+
+/**
+ * @brief store a single log record. A record is either a text message or a deferred call with its raw arguments.
+ */
+typedef struct s_LogRecord {
+    /**
+     * @brief the identifier of the call site or 0 for a text message
+     */
+    uint32_t site;
+    /**
+     * @brief the amount of bytes used for the arguments or the length of a text message stored in the record
+     */
+    uint16_t argBytes;
+    /**
+     * @brief the level of a text message (GLGE_LOG_RECORD_LEVEL_MASK) and GLGE_LOG_RECORD_HEAP_TEXT. 0 for deferred
+     * calls, their level is stored at the call site.
+     */
+    uint16_t flags;
+    /**
+     * @brief the time the record was created at in nanoseconds since the unix epoch
+     */
+    uint64_t timestamp;
+    /**
+     * @brief the payload of the record
+     */
+    union {
+        /**
+         * @brief the message of a text record that did not fit into the record. Owned by the record.
+         */
+        String* text;
+        /**
+         * @brief the encoded arguments of a deferred call or the message of a short text record
+         */
+        uint8_t args[GLGE_LOG_RECORD_ARG_BYTES];
+    } data;
+} LogRecord;
+
+/**
+ * @brief initialize the call site of the current line
+ * 
+ * @param level the level of the messages of the call site
+ */
+#define GLGE_LOG_CALL_SITE_INIT(level) {__FILE__, __LINE__, (uint8_t)(level), NULL, GLGE_ATOMIC_INIT(0), 0, {0}, 0}
+
+/**
+ * @brief log a printf style message without formatting it on the calling thread
+ * 
+ * Only an identifier of the call, a timestamp and the raw arguments are recorded. The text is created later by the
+ * writer thread of an asynchronous logger, or offline from a binary log file. The format must be the same string for
+ * every execution of the call, which is given for string literals.
+ * 
+ * @param logger a pointer to the logger to log to
+ * @param ... the format string followed by its arguments
+ */
+#define GLGE_LOG_DEFERRED(logger, ...) do { \
+    static LogCallSite __glgeLogCallSite = GLGE_LOG_CALL_SITE_INIT(GLGE_LOG_LEVEL_NONE); \
+    logger_logDeferred(&__glgeLogCallSite, (logger), __VA_ARGS__); \
+} while (0)
+
+//the binary writer is only available to C++
+#if __cplusplus
+
+/**
+ * @brief write log records to a binary log file
+ * 
+ * A binary log file starts with GLGE_BINARY_LOG_MAGIC, followed by entries in the native byte order. Each entry starts
+ * with a single byte for its kind:
+ * 1 - a call site: uint32 identifier, uint32 line, uint8 level, uint16 format length, format, uint16 file length, file
+ * 2 - a deferred call: uint32 call site identifier, uint64 timestamp, uint16 argument bytes, arguments
+ * 3 - a text message: uint64 timestamp, uint32 length, characters
+ * Call sites are written before their first call.
+ */
+struct BinaryLogWriter
+{
+    /**
+     * @brief Construct a new Binary Log Writer
+     * 
+     * @param path the path of the file to create
+     */
+    BinaryLogWriter(const char* path);
+
+    /**
+     * @brief Destroy the Binary Log Writer and close the file
+     */
+    ~BinaryLogWriter();
+
+    /**
+     * @brief check if the file could be opened
+     * 
+     * @return true : the file is open
+     * @return false : the file could not be created
+     */
+    inline bool isOpen() const noexcept {return m_file != nullptr;}
+
+    /**
+     * @brief write a single record to the file
+     * 
+     * @param record the record to write
+     */
+    void write(const LogRecord& record);
+
+    /**
+     * @brief flush the written records to the operating system
+     */
+    void flush();
+
+protected:
+
+    /**
+     * @brief the file to write to
+     */
+    FILE* m_file = nullptr;
+    /**
+     * @brief store which call sites were already written
+     */
+    std::vector<bool> m_sites;
+};
+
+#endif
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief register a call site. Only needed once per call site, logger_logDeferred does this automatically.
+ * 
+ * @param site the call site to register
+ * @param format the format string of the call site
+ * @return uint32_t the identifier of the call site
+ */
+uint32_t logCallSite_Register(LogCallSite* site, const char* format);
+
+/**
+ * @brief get a registered call site by its identifier
+ * 
+ * @param id the identifier of the call site
+ * @return const LogCallSite* the call site or NULL if the identifier is unknown
+ */
+const LogCallSite* logCallSite_Get(uint32_t id);
+
+/**
+ * @brief fill a record with a deferred call
+ * 
+ * @param site the call site of the call. Must be registered.
+ * @param args the arguments of the call
+ * @param record the record to fill
+ */
+void logRecord_Encode(const LogCallSite* site, va_list args, LogRecord* record);
+
+/**
+ * @brief fill a record with a text message. Short text is copied into the record, only longer text is allocated.
+ * 
+ * @param text the message
+ * @param length the length of the message in bytes
+ * @param level the level of the message
+ * @param record the record to fill. Its site is set to 0.
+ */
+void logRecord_SetText(const char* text, uint64_t length, LogLevel level, LogRecord* record);
+
+/**
+ * @brief get the message of a text record
+ * 
+ * @param length filled with the length of the message in bytes
+ * @param record the text record to quarry
+ * @return const char* the message. Not null terminated.
+ */
+const char* logRecord_Text(uint64_t* length, const LogRecord* record);
+
+/**
+ * @brief free the message of a text record if it was allocated. Does nothing for other records.
+ * 
+ * @param record the record to release
+ */
+void logRecord_Release(const LogRecord* record);
+
+/**
+ * @brief format encoded arguments with a format string and append the text to a string
+ * 
+ * @param format the format string of the call site
+ * @param args the encoded arguments
+ * @param argBytes the amount of bytes of the encoded arguments
+ * @param out the string to append the text to
+ */
+void logRecord_Format(const char* format, const uint8_t* args, uint16_t argBytes, String* out);
+
+/**
+ * @brief get the current time as used for log records
+ * 
+ * @return uint64_t the nanoseconds since the unix epoch
+ */
+uint64_t logRecord_Now();
+
+/**
+ * @brief read a binary log file and turn each entry into a line of text
+ * 
+ * @param path the path of the binary log file
+ * @param func the function to call for each line. The lines are prefixed with the timestamp in seconds.
+ * @return true : the file was decoded
+ * @return false : the file could not be opened or is not a binary log file
+ */
+bool binaryLog_Decode(const char* path, void (*func)(String* line));
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,285 @@
+/**
+ * @file FileSink.cpp
+ * @author DM8AT
+ * @brief implement the buffered log file
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the file sink
+#include "FileSink.h"
+
+//memory management stuff
+#include <cstring>
+#include <cstdio>
+#include <cerrno>
+
+//include the platform's file functions
+#if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+#include <io.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#endif
+
+s_FileSink::s_FileSink(const FileSinkCreateInfo& info)
+ : m_info(info), m_path(info.path ? info.path : "")
+{
+    //apply the defaults
+    if (m_info.bufferSize == 0) {m_info.bufferSize = GLGE_FILE_SINK_DEFAULT_BUFFER_SIZE;}
+    if (m_info.compress && (m_info.bufferSize > GLGE_LOG_FRAME_MAX_SIZE)) {m_info.bufferSize = GLGE_LOG_FRAME_MAX_SIZE;}
+    if ((m_info.flushBytes == 0) || (m_info.flushBytes > m_info.bufferSize)) {m_info.flushBytes = m_info.bufferSize;}
+    m_info.path = m_path.c_str();
+
+    m_buffer = new char[m_info.bufferSize];
+    //a frame never holds more than a full buffer
+    if (m_info.compress) {m_frame = new char[GLGE_LOG_FRAME_HEADER_SIZE + logCompression_Bound(m_info.bufferSize)];}
+    m_lastWrite = std::chrono::steady_clock::now();
+    open();
+}
+
+s_FileSink::~s_FileSink()
+{
+    if (m_fd >= 0)
+    {
+        writeOut(nullptr, 0);
+        if (m_info.sync != GLGE_FILE_SINK_SYNC_NEVER) {sync();}
+        #if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+        _close(m_fd);
+        #else
+        close(m_fd);
+        #endif
+    }
+    delete[] m_buffer;
+    delete[] m_frame;
+}
+
+void s_FileSink::write(const char* text, uint64_t size, LogLevel level)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (m_fd < 0) {return;}
+
+    //rotate before the file would get too large. Text is never split, so a single write larger than the limit still
+    //ends up in a single file.
+    if ((m_info.maxFileSize != 0) && (m_written + m_used != 0) && (m_written + m_used + size > m_info.maxFileSize))
+    {
+        writeOut(nullptr, 0);
+        rotate();
+        if (m_fd < 0) {return;}
+    }
+
+    //small text is collected, text that does not fit is written together with the buffer
+    if (m_used + size <= m_info.bufferSize)
+    {
+        memcpy(m_buffer + m_used, text, size);
+        m_used += size;
+    }
+    else {writeOut(text, size);}
+
+    //check the flush triggers
+    if (m_used == 0) {return;}
+    bool urgent = (m_info.flushLevel != GLGE_LOG_LEVEL_NONE) && (level != GLGE_LOG_LEVEL_NONE) && (level >= m_info.flushLevel);
+    bool due = (m_info.flushIntervalMs != 0) &&
+               (std::chrono::steady_clock::now() - m_lastWrite >= std::chrono::milliseconds(m_info.flushIntervalMs));
+    if (urgent || due || (m_used >= m_info.flushBytes)) {writeOut(nullptr, 0);}
+}
+
+void s_FileSink::flush()
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (m_fd >= 0) {writeOut(nullptr, 0);}
+}
+
+bool s_FileSink::flushIfDue()
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if ((m_fd < 0) || (m_used == 0) || (m_info.flushIntervalMs == 0)) {return false;}
+    if (std::chrono::steady_clock::now() - m_lastWrite < std::chrono::milliseconds(m_info.flushIntervalMs)) {return false;}
+    writeOut(nullptr, 0);
+    return true;
+}
+
+uint64_t s_FileSink::fileSize() noexcept
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_written + m_used;
+}
+
+void s_FileSink::writeOut(const char* text, uint64_t size)
+{
+    if ((m_used == 0) && (size == 0)) {return;}
+    if (m_frame) {writeCompressed(text, size); return;}
+    uint64_t total = m_used + size;
+
+    #if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+    //windows has no vectored write for normal files, so write both parts after each other
+    const char* parts[2] = {m_buffer, text};
+    uint64_t sizes[2] = {m_used, size};
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+        uint64_t done = 0;
+        while (done < sizes[i])
+        {
+            uint64_t chunk = sizes[i] - done;
+            int n = _write(m_fd, parts[i] + done, (unsigned int)((chunk > 0x40000000u) ? 0x40000000u : chunk));
+            if (n <= 0) {break;}
+            done += (uint64_t)n;
+        }
+    }
+    #else
+    //write the buffer and the text with a single system call
+    struct iovec iov[2];
+    iov[0].iov_base = m_buffer;
+    iov[0].iov_len = m_used;
+    iov[1].iov_base = (void*)text;
+    iov[1].iov_len = size;
+    struct iovec* cur = (m_used == 0) ? &iov[1] : &iov[0];
+    int count = (size == 0) ? 1 : ((m_used == 0) ? 1 : 2);
+    while (count > 0)
+    {
+        ssize_t n = writev(m_fd, cur, count);
+        if (n < 0)
+        {
+            //retry on interruption, give up on real errors
+            if (errno == EINTR) {continue;}
+            break;
+        }
+        //skip the written parts
+        while ((count > 0) && ((size_t)n >= cur->iov_len))
+        {
+            n -= (ssize_t)cur->iov_len;
+            ++cur;
+            --count;
+        }
+        if (count > 0)
+        {
+            cur->iov_base = (char*)cur->iov_base + n;
+            cur->iov_len -= (size_t)n;
+        }
+    }
+    #endif
+
+    m_written += total;
+    m_used = 0;
+    m_lastWrite = std::chrono::steady_clock::now();
+    if (m_info.sync == GLGE_FILE_SINK_SYNC_FLUSH) {sync();}
+}
+
+void s_FileSink::writeCompressed(const char* text, uint64_t size)
+{
+    //the buffer is a frame of its own, additional text is split into frames of at most the buffer size
+    if (m_used != 0) {writeRaw(m_frame, logCompression_WriteFrame(m_buffer, m_used, m_frame));}
+    for (uint64_t done = 0; done < size;)
+    {
+        uint64_t chunk = ((size - done) > m_info.bufferSize) ? m_info.bufferSize : (size - done);
+        writeRaw(m_frame, logCompression_WriteFrame(text + done, chunk, m_frame));
+        done += chunk;
+    }
+
+    m_used = 0;
+    m_lastWrite = std::chrono::steady_clock::now();
+    if (m_info.sync == GLGE_FILE_SINK_SYNC_FLUSH) {sync();}
+}
+
+void s_FileSink::writeRaw(const void* data, uint64_t size)
+{
+    const char* ptr = (const char*)data;
+    uint64_t done = 0;
+    while (done < size)
+    {
+        uint64_t chunk = size - done;
+        #if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+        int n = _write(m_fd, ptr + done, (unsigned int)((chunk > 0x40000000u) ? 0x40000000u : chunk));
+        if (n <= 0) {break;}
+        #else
+        ssize_t n = ::write(m_fd, ptr + done, (size_t)chunk);
+        if (n < 0)
+        {
+            //retry on interruption, give up on real errors
+            if (errno == EINTR) {continue;}
+            break;
+        }
+        #endif
+        done += (uint64_t)n;
+    }
+    m_written += size;
+}
+
+void s_FileSink::sync()
+{
+    #if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+    _commit(m_fd);
+    #elif __linux
+    //the metadata is not needed to read the log back
+    fdatasync(m_fd);
+    #else
+    fsync(m_fd);
+    #endif
+}
+
+void s_FileSink::rotate()
+{
+    //the old file is complete, make sure it is stored
+    if (m_info.sync != GLGE_FILE_SINK_SYNC_NEVER) {sync();}
+    #if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+    _close(m_fd);
+    #else
+    close(m_fd);
+    #endif
+    m_fd = -1;
+
+    if (m_info.maxFiles == 0)
+    {
+        //no old files are kept, start the file over
+        remove(m_path.c_str());
+    }
+    else
+    {
+        //shift the old files by one, the oldest one is deleted
+        std::string from, to = m_path + "." + std::to_string(m_info.maxFiles);
+        remove(to.c_str());
+        for (uint32_t i = m_info.maxFiles - 1; i > 0; --i)
+        {
+            from = m_path + "." + std::to_string(i);
+            rename(from.c_str(), to.c_str());
+            to = from;
+        }
+        rename(m_path.c_str(), to.c_str());
+    }
+
+    open();
+}
+
+void s_FileSink::open()
+{
+    #if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+    m_fd = _open(m_path.c_str(), _O_WRONLY | _O_CREAT | _O_APPEND | _O_BINARY, _S_IREAD | _S_IWRITE);
+    m_written = (m_fd >= 0) ? (uint64_t)_lseeki64(m_fd, 0, SEEK_END) : 0;
+    #else
+    m_fd = ::open(m_path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    m_written = (m_fd >= 0) ? (uint64_t)lseek(m_fd, 0, SEEK_END) : 0;
+    #endif
+}
+
+
+extern "C" {
+
+FileSink* fileSink_Create(const FileSinkCreateInfo* info) {return new FileSink(*info);}
+
+void fileSink_Destroy(FileSink* sink) {delete sink;}
+
+bool fileSink_IsOpen(const FileSink* sink) {return sink->isOpen();}
+
+void fileSink_Write(const char* text, uint64_t size, LogLevel level, FileSink* sink) {sink->write(text, size, level);}
+
+void fileSink_Flush(FileSink* sink) {sink->flush();}
+
+bool fileSink_FlushIfDue(FileSink* sink) {return sink->flushIfDue();}
+
+}
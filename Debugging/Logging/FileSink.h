@@ -0,0 +1,315 @@
+/**
+ * @file FileSink.h
+ * @author DM8AT
+ * @brief define a buffered log file with batched writes and size based rotation
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_BG_FILE_SINK_
+#define _GLGE_BG_FILE_SINK_
+
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+//the severity of the written text can trigger a flush
+#include "LogLevel.h"
+//the file can be compressed
+#include "LogCompression.h"
+
+//include strings and mutexes for C++
+#if __cplusplus
+#include <string>
+#include <mutex>
+#include <chrono>
+#endif
+
+/**
+ * @brief the size of the buffer of a file sink if none is specified
+ */
+#define GLGE_FILE_SINK_DEFAULT_BUFFER_SIZE (64*1024)
+
+/**
+ * @brief define when a file sink forces the written data to the storage device
+ */
+typedef enum e_FileSinkSync {
+    /**
+     * @brief never, the operating system decides when the data is stored
+     */
+    GLGE_FILE_SINK_SYNC_NEVER = 0,
+    /**
+     * @brief after every flush of the buffer
+     */
+    GLGE_FILE_SINK_SYNC_FLUSH,
+    /**
+     * @brief only before a file is rotated or closed
+     */
+    GLGE_FILE_SINK_SYNC_ROTATE
+} FileSinkSync;
+
+/**
+ * @brief store the options a file sink is created with. Zero-initialized members use their default.
+ */
+typedef struct s_FileSinkCreateInfo {
+    /**
+     * @brief the path of the log file. Output is appended if the file exists.
+     */
+    const char* path;
+    /**
+     * @brief the size of the buffer in bytes. 0 means GLGE_FILE_SINK_DEFAULT_BUFFER_SIZE.
+     */
+    uint64_t bufferSize;
+    /**
+     * @brief the buffer is written once it holds at least this many bytes. 0 means only once the buffer is full.
+     */
+    uint64_t flushBytes;
+    /**
+     * @brief the buffer is written if the last write is at least this many milliseconds ago. 0 disables the time trigger.
+     * 
+     * The trigger is checked when text is written and by flushIfDue. Asynchronous loggers call flushIfDue from their
+     * writer thread while idle, so a buffered tail is written in time. Otherwise it waits for the next write or flush.
+     */
+    uint64_t flushIntervalMs;
+    /**
+     * @brief text of at least this level is written immediately. GLGE_LOG_LEVEL_NONE disables the level trigger.
+     */
+    LogLevel flushLevel;
+    /**
+     * @brief the file is rotated before it would grow larger than this many bytes. 0 disables rotation.
+     */
+    uint64_t maxFileSize;
+    /**
+     * @brief the amount of rotated files that are kept (path.1 is the newest). 0 means the file is truncated on rotation.
+     */
+    uint32_t maxFiles;
+    /**
+     * @brief when the data is forced to the storage device
+     */
+    FileSinkSync sync;
+    /**
+     * @brief true to compress the file in frames of at most the buffer size. Read it back with logCompression_DecompressFile.
+     */
+    bool compress;
+} FileSinkCreateInfo;
+
+/**
+ * @brief store a log file that collects text in a large buffer and writes it in batches
+ */
+typedef struct s_FileSink {
+
+    //check for C++ to define the file sink
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new File Sink
+     * 
+     * @param info the options of the sink. The path is copied.
+     */
+    s_FileSink(const FileSinkCreateInfo& info);
+
+    /**
+     * @brief Destroy the File Sink. Writes all buffered text.
+     */
+    ~s_FileSink();
+
+    /**
+     * @brief check if the file could be opened
+     * 
+     * @return true : the file is open
+     * @return false : the file could not be opened, all text is discarded
+     */
+    inline bool isOpen() const noexcept {return m_fd >= 0;}
+
+    /**
+     * @brief write text to the sink. Text that does not fit into the buffer is written directly, together with the buffer.
+     * 
+     * @param text the text to write. Should consist of complete lines, so rotation does not split lines.
+     * @param size the size of the text in bytes
+     * @param level the highest level of the messages in the text
+     */
+    void write(const char* text, uint64_t size, LogLevel level = GLGE_LOG_LEVEL_NONE);
+
+    /**
+     * @brief write the buffered text to the file
+     */
+    void flush();
+
+    /**
+     * @brief write the buffered text to the file if the time trigger is due
+     * 
+     * @return true : buffered text was written
+     * @return false : nothing was written
+     */
+    bool flushIfDue();
+
+    /**
+     * @brief get the interval of the time trigger
+     * 
+     * @return uint64_t the interval in milliseconds or 0 if the time trigger is disabled
+     */
+    inline uint64_t flushIntervalMs() const noexcept {return m_info.flushIntervalMs;}
+
+    /**
+     * @brief get the size of the current file including the buffered text
+     * 
+     * @return uint64_t the size in bytes
+     */
+    uint64_t fileSize() noexcept;
+
+protected:
+
+    /**
+     * @brief write the buffer and optionally more text with a single system call where possible. The mutex must be locked.
+     * 
+     * @param text additional text to write after the buffer or NULL
+     * @param size the size of the additional text
+     */
+    void writeOut(const char* text, uint64_t size);
+
+    /**
+     * @brief compress the buffer and optionally more text into frames and write them. The mutex must be locked.
+     * 
+     * @param text additional text to compress after the buffer or NULL
+     * @param size the size of the additional text
+     */
+    void writeCompressed(const char* text, uint64_t size);
+
+    /**
+     * @brief write bytes to the file, retrying on interruptions. The mutex must be locked.
+     * 
+     * @param data the bytes to write
+     * @param size the amount of bytes to write
+     */
+    void writeRaw(const void* data, uint64_t size);
+
+    /**
+     * @brief force the written data to the storage device
+     */
+    void sync();
+
+    /**
+     * @brief close the current file, shift the rotated files and open a new file. The buffer must be empty.
+     */
+    void rotate();
+
+    /**
+     * @brief open the file at the stored path
+     */
+    void open();
+
+    /**
+     * @brief the options of the sink
+     */
+    FileSinkCreateInfo m_info;
+    /**
+     * @brief the copied path of the file
+     */
+    std::string m_path;
+    /**
+     * @brief the file descriptor or -1
+     */
+    int m_fd = -1;
+    /**
+     * @brief the buffered text
+     */
+    char* m_buffer = nullptr;
+    /**
+     * @brief the memory a single compressed frame is created in or NULL if the sink does not compress
+     */
+    char* m_frame = nullptr;
+    /**
+     * @brief the amount of buffered bytes
+     */
+    uint64_t m_used = 0;
+    /**
+     * @brief the amount of bytes in the file, without the buffer. For compressing sinks, this is the compressed size.
+     */
+    uint64_t m_written = 0;
+    /**
+     * @brief the time of the last write to the file
+     */
+    std::chrono::steady_clock::time_point m_lastWrite;
+    /**
+     * @brief protects the sink, as multiple threads may write at once
+     */
+    std::mutex m_mutex;
+
+    #else
+
+    //for windows, add a single byte here to make the struct contain something
+    uint8_t byte;
+
+    #endif
+
+    //for C, this is an opaque structure
+
+} FileSink;
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief create a new file sink
+ * 
+ * @param info the options of the sink
+ * @return FileSink* a pointer to the new file sink
+ */
+FileSink* fileSink_Create(const FileSinkCreateInfo* info);
+
+/**
+ * @brief destroy a file sink. Writes all buffered text.
+ * 
+ * @param sink a pointer to the file sink to destroy
+ */
+void fileSink_Destroy(FileSink* sink);
+
+/**
+ * @brief check if the file of a file sink could be opened
+ * 
+ * @param sink a pointer to the file sink to quarry
+ * @return true : the file is open
+ * @return false : the file could not be opened
+ */
+bool fileSink_IsOpen(const FileSink* sink);
+
+/**
+ * @brief write text to a file sink
+ * 
+ * @param text the text to write
+ * @param size the size of the text in bytes
+ * @param level the highest level of the messages in the text
+ * @param sink a pointer to the file sink to write to
+ */
+void fileSink_Write(const char* text, uint64_t size, LogLevel level, FileSink* sink);
+
+/**
+ * @brief write the buffered text of a file sink to its file
+ * 
+ * @param sink a pointer to the file sink to flush
+ */
+void fileSink_Flush(FileSink* sink);
+
+/**
+ * @brief write the buffered text of a file sink to its file if the time trigger is due
+ * 
+ * @param sink a pointer to the file sink to flush
+ * @return true : buffered text was written
+ * @return false : nothing was written
+ */
+bool fileSink_FlushIfDue(FileSink* sink);
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,422 @@
+/**
+ * @file FlightRecorder.cpp
+ * @author DM8AT
+ * @brief implement the flight recorder and its crash handler
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the flight recorder
+#include "FlightRecorder.h"
+
+//memory management stuff
+#include <cstring>
+#include <cstdio>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+
+//include the platform's file functions
+#if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+/**
+ * @brief the amount of header words of a record: sequence, timestamp, length and level
+ */
+#define GLGE_FLIGHT_RECORDER_HEADER_WORDS 3
+
+/**
+ * @brief store a single ring of records
+ * 
+ * Each record is a row of words, so dumping threads can read them without data races. The first word is a sequence:
+ * odd while the record is written, 2*(ticket+1) once the record with that ticket is complete.
+ */
+struct FlightRecorderRing
+{
+    /**
+     * @brief the ticket of the next record
+     */
+    alignas(64) std::atomic<uint64_t> head{0};
+    /**
+     * @brief the words of all records
+     */
+    std::atomic<uint64_t>* words = nullptr;
+};
+
+/**
+ * @brief the recorder that is dumped on a fatal signal
+ */
+static std::atomic<const s_FlightRecorder*> __flightRecorderCrash{nullptr};
+/**
+ * @brief the file descriptor the crash dump is written to
+ */
+static std::atomic<int> __flightRecorderCrashFd{2};
+/**
+ * @brief the maximum amount of records of the crash dump
+ */
+static std::atomic<uint64_t> __flightRecorderCrashMax{0};
+
+/**
+ * @brief write a complete buffer to a file descriptor. Async-signal-safe.
+ * 
+ * @param fd the file descriptor to write to
+ * @param data the data to write
+ * @param size the size of the data in bytes
+ */
+static void __flightRecorderWrite(int fd, const char* data, uint64_t size) noexcept
+{
+    while (size > 0)
+    {
+        #if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+        int n = _write(fd, data, (unsigned int)size);
+        #else
+        ssize_t n = write(fd, data, size);
+        #endif
+        if (n < 0)
+        {
+            if (errno == EINTR) {continue;}
+            return;
+        }
+        data += n;
+        size -= (uint64_t)n;
+    }
+}
+
+/**
+ * @brief write an unsigned integer as decimal text. Async-signal-safe.
+ * 
+ * @param out the buffer to write to
+ * @param value the value to write
+ * @param digits the minimum amount of digits, padded with zeros
+ * @return char* a pointer after the last written character
+ */
+static char* __flightRecorderNumber(char* out, uint64_t value, uint32_t digits) noexcept
+{
+    char tmp[24];
+    uint32_t n = 0;
+    do {tmp[n++] = (char)('0' + (value % 10)); value /= 10;} while (value != 0);
+    while (n < digits) {tmp[n++] = '0';}
+    while (n > 0) {*out++ = tmp[--n];}
+    return out;
+}
+
+/**
+ * @brief the fatal signals the crash handler is installed for. abort() (and so GLGE_ABORT) raises SIGABRT.
+ */
+static const int __flightRecorderSignals[] = {SIGABRT, SIGSEGV, SIGILL, SIGFPE,
+    #ifdef SIGBUS
+    SIGBUS,
+    #endif
+};
+
+/**
+ * @brief the amount of fatal signals
+ */
+#define GLGE_FLIGHT_RECORDER_SIGNAL_COUNT (sizeof(__flightRecorderSignals) / sizeof(__flightRecorderSignals[0]))
+
+/**
+ * @brief true once the crash handler is installed, so a second installation does not save the own handler
+ */
+static std::atomic<bool> __flightRecorderInstalled{false};
+
+#if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+/**
+ * @brief the handlers the application had installed before the crash handler
+ */
+static void (*__flightRecorderPrevious[GLGE_FLIGHT_RECORDER_SIGNAL_COUNT])(int);
+#else
+/**
+ * @brief the actions the application had installed before the crash handler
+ */
+static struct sigaction __flightRecorderPrevious[GLGE_FLIGHT_RECORDER_SIGNAL_COUNT];
+#endif
+
+/**
+ * @brief the handler for fatal signals
+ * 
+ * @param sig the received signal
+ * @param info information about the signal or NULL
+ * @param context the interrupted context or NULL
+ */
+static void __flightRecorderSignal(int sig, void* info, void* context)
+{
+    //only the first fatal signal dumps
+    const s_FlightRecorder* recorder = __flightRecorderCrash.exchange(nullptr);
+    if (recorder)
+    {
+        static const char header[] = "\n--- flight recorder ---\n";
+        int fd = __flightRecorderCrashFd.load(std::memory_order_relaxed);
+        __flightRecorderWrite(fd, header, sizeof(header) - 1);
+        recorder->dump(fd, __flightRecorderCrashMax.load(std::memory_order_relaxed));
+    }
+
+    //restore the handler the application had before and hand the signal on to it
+    uint32_t index = 0;
+    while ((index < GLGE_FLIGHT_RECORDER_SIGNAL_COUNT) && (__flightRecorderSignals[index] != sig)) {++index;}
+    if (index < GLGE_FLIGHT_RECORDER_SIGNAL_COUNT)
+    {
+        #if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+        (void)info; (void)context;
+        void (*previous)(int) = __flightRecorderPrevious[index];
+        signal(sig, previous);
+        if ((previous != SIG_DFL) && (previous != SIG_IGN) && (previous != SIG_ERR) && previous) {previous(sig); return;}
+        #else
+        const struct sigaction& previous = __flightRecorderPrevious[index];
+        sigaction(sig, &previous, nullptr);
+        if (previous.sa_flags & SA_SIGINFO) {previous.sa_sigaction(sig, (siginfo_t*)info, context); return;}
+        if ((previous.sa_handler != SIG_DFL) && (previous.sa_handler != SIG_IGN)) {previous.sa_handler(sig); return;}
+        #endif
+    }
+    //let the default handler terminate the program. An ignored fatal signal would only repeat.
+    signal(sig, SIG_DFL);
+    raise(sig);
+}
+
+#if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+/**
+ * @brief the handler with the signature of signal()
+ * 
+ * @param sig the received signal
+ */
+static void __flightRecorderSignalPlain(int sig) {__flightRecorderSignal(sig, nullptr, nullptr);}
+#else
+/**
+ * @brief the handler with the signature of sigaction()
+ * 
+ * @param sig the received signal
+ * @param info information about the signal
+ * @param context the interrupted context
+ */
+static void __flightRecorderSignalInfo(int sig, siginfo_t* info, void* context) {__flightRecorderSignal(sig, info, context);}
+#endif
+
+s_FlightRecorder::s_FlightRecorder(const FlightRecorderCreateInfo& info)
+{
+    //apply the defaults and limits
+    uint64_t recordSize = (info.recordSize == 0) ? GLGE_FLIGHT_RECORDER_DEFAULT_RECORD_SIZE : info.recordSize;
+    recordSize = (recordSize < 64) ? 64 : ((recordSize > GLGE_FLIGHT_RECORDER_MAX_RECORD_SIZE) ? GLGE_FLIGHT_RECORDER_MAX_RECORD_SIZE : recordSize);
+    m_recordWords = (recordSize + 7) / 8;
+    m_recordCount = 1;
+    uint64_t count = (info.recordCount == 0) ? GLGE_FLIGHT_RECORDER_DEFAULT_RECORD_COUNT : info.recordCount;
+    while (m_recordCount < count) {m_recordCount <<= 1;}
+    m_ringCount = (info.ringCount == 0) ? 1 : ((info.ringCount > GLGE_FLIGHT_RECORDER_MAX_RINGS) ? GLGE_FLIGHT_RECORDER_MAX_RINGS : info.ringCount);
+
+    //allocate all memory up front. Atomics are zero initialized, so all records are empty.
+    m_rings = new FlightRecorderRing[m_ringCount];
+    for (uint32_t i = 0; i < m_ringCount; ++i) {m_rings[i].words = new std::atomic<uint64_t>[m_recordWords * m_recordCount]();}
+}
+
+s_FlightRecorder::~s_FlightRecorder()
+{
+    //never dump a destroyed recorder
+    const s_FlightRecorder* self = this;
+    __flightRecorderCrash.compare_exchange_strong(self, nullptr);
+
+    for (uint32_t i = 0; i < m_ringCount; ++i) {delete[] m_rings[i].words;}
+    delete[] m_rings;
+}
+
+FlightRecorderRing& s_FlightRecorder::ring() noexcept
+{
+    if (m_ringCount == 1) {return m_rings[0];}
+
+    //each thread remembers its ring for the last recorder it used
+    thread_local const s_FlightRecorder* owner = nullptr;
+    thread_local uint32_t index = 0;
+    if (owner != this)
+    {
+        index = m_nextRing.fetch_add(1, std::memory_order_relaxed);
+        owner = this;
+    }
+    return m_rings[index % m_ringCount];
+}
+
+void s_FlightRecorder::store(uint64_t* words, uint64_t wordCount) noexcept
+{
+    FlightRecorderRing& r = ring();
+    uint64_t ticket = r.head.fetch_add(1, std::memory_order_relaxed);
+    std::atomic<uint64_t>* record = r.words + (ticket & (m_recordCount - 1)) * m_recordWords;
+
+    //mark the record as in progress before any word changes
+    record[0].store(2*ticket + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (uint64_t i = 1; i < wordCount; ++i) {record[i].store(words[i], std::memory_order_relaxed);}
+    //publish the record
+    record[0].store(2*ticket + 2, std::memory_order_release);
+}
+
+void s_FlightRecorder::record(LogLevel level, const char* text, uint64_t length, bool prefix) noexcept
+{
+    uint64_t words[GLGE_FLIGHT_RECORDER_MAX_RECORD_SIZE / 8];
+    char* out = (char*)(words + GLGE_FLIGHT_RECORDER_HEADER_WORDS);
+    uint64_t capacity = (m_recordWords - GLGE_FLIGHT_RECORDER_HEADER_WORDS) * 8;
+
+    //the level prefix is followed by as much of the text as fits
+    const char* start = prefix ? logLevel_Prefix(level) : "";
+    uint64_t used = strlen(start);
+    used = (used > capacity) ? capacity : used;
+    memcpy(out, start, used);
+    length = (length > capacity - used) ? capacity - used : length;
+    memcpy(out + used, text, length);
+    used += length;
+
+    words[1] = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    words[2] = used | ((uint64_t)level << 32);
+    store(words, GLGE_FLIGHT_RECORDER_HEADER_WORDS + (used + 7) / 8);
+}
+
+void s_FlightRecorder::recordFormatted(LogLevel level, const char* format, va_list args) noexcept
+{
+    uint64_t words[GLGE_FLIGHT_RECORDER_MAX_RECORD_SIZE / 8];
+    char* out = (char*)(words + GLGE_FLIGHT_RECORDER_HEADER_WORDS);
+    uint64_t capacity = (m_recordWords - GLGE_FLIGHT_RECORDER_HEADER_WORDS) * 8;
+
+    //format directly into the record, including the null terminator of vsnprintf
+    const char* prefix = logLevel_Prefix(level);
+    uint64_t used = strlen(prefix);
+    used = (used > capacity - 1) ? capacity - 1 : used;
+    memcpy(out, prefix, used);
+    int length = vsnprintf(out + used, capacity - used, format, args);
+    if (length > 0) {used += ((uint64_t)length >= capacity - used) ? capacity - used - 1 : (uint64_t)length;}
+
+    words[1] = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    words[2] = used | ((uint64_t)level << 32);
+    store(words, GLGE_FLIGHT_RECORDER_HEADER_WORDS + (used + 7) / 8);
+}
+
+/**
+ * @brief read a complete record. Async-signal-safe.
+ * 
+ * @param ring the ring to read from
+ * @param ticket the ticket of the record
+ * @param recordWords the amount of words per record
+ * @param recordCount the amount of records of the ring
+ * @param out the words to copy the record to. If headerOnly is set, only the header is copied.
+ * @param headerOnly true to only read the header
+ * @return true : the record is complete and was not overwritten while reading
+ * @return false : the record is in progress or was overwritten
+ */
+static bool __flightRecorderRead(const FlightRecorderRing& ring, uint64_t ticket, uint64_t recordWords, uint64_t recordCount,
+                                 uint64_t* out, bool headerOnly) noexcept
+{
+    const std::atomic<uint64_t>* record = ring.words + (ticket & (recordCount - 1)) * recordWords;
+    uint64_t seq = record[0].load(std::memory_order_acquire);
+    if (seq != 2*ticket + 2) {return false;}
+
+    out[1] = record[1].load(std::memory_order_relaxed);
+    out[2] = record[2].load(std::memory_order_relaxed);
+    if (!headerOnly)
+    {
+        uint64_t length = out[2] & 0xFFFFFFFFull;
+        uint64_t words = GLGE_FLIGHT_RECORDER_HEADER_WORDS + (length + 7) / 8;
+        words = (words > recordWords) ? recordWords : words;
+        for (uint64_t i = GLGE_FLIGHT_RECORDER_HEADER_WORDS; i < words; ++i) {out[i] = record[i].load(std::memory_order_relaxed);}
+    }
+
+    //the record is valid if no writer started in between
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return record[0].load(std::memory_order_relaxed) == seq;
+}
+
+uint64_t s_FlightRecorder::dump(int fd, uint64_t maxRecords) const noexcept
+{
+    //the range of records that are still stored in each ring
+    uint64_t cursor[GLGE_FLIGHT_RECORDER_MAX_RINGS];
+    uint64_t end[GLGE_FLIGHT_RECORDER_MAX_RINGS];
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < m_ringCount; ++i)
+    {
+        end[i] = m_rings[i].head.load(std::memory_order_acquire);
+        uint64_t available = (end[i] > m_recordCount) ? m_recordCount : end[i];
+        cursor[i] = end[i] - available;
+        total += available;
+    }
+    //only the newest records are written
+    uint64_t skip = (total > maxRecords) ? total - maxRecords : 0;
+
+    uint64_t words[GLGE_FLIGHT_RECORDER_MAX_RECORD_SIZE / 8];
+    char line[GLGE_FLIGHT_RECORDER_MAX_RECORD_SIZE + 48];
+    uint64_t written = 0;
+    while (true)
+    {
+        //merge the rings by taking the oldest record of all rings
+        int32_t best = -1;
+        uint64_t bestTime = 0;
+        for (uint32_t i = 0; i < m_ringCount; ++i)
+        {
+            //skip records that are in progress or overwritten
+            while ((cursor[i] < end[i]) && !__flightRecorderRead(m_rings[i], cursor[i], m_recordWords, m_recordCount, words, true))
+            {++cursor[i]; skip = (skip > 0) ? skip - 1 : 0;}
+            if (cursor[i] == end[i]) {continue;}
+            if ((best < 0) || (words[1] < bestTime)) {best = (int32_t)i; bestTime = words[1];}
+        }
+        if (best < 0) {break;}
+
+        uint64_t ticket = cursor[best]++;
+        if (skip > 0) {--skip; continue;}
+        if (!__flightRecorderRead(m_rings[best], ticket, m_recordWords, m_recordCount, words, false)) {continue;}
+
+        //format the line: "[seconds.nanoseconds] text\n"
+        char* out = line;
+        *out++ = '[';
+        out = __flightRecorderNumber(out, words[1] / 1000000000ull, 1);
+        *out++ = '.';
+        out = __flightRecorderNumber(out, words[1] % 1000000000ull, 9);
+        *out++ = ']';
+        *out++ = ' ';
+        uint64_t length = words[2] & 0xFFFFFFFFull;
+        uint64_t capacity = (m_recordWords - GLGE_FLIGHT_RECORDER_HEADER_WORDS) * 8;
+        length = (length > capacity) ? capacity : length;
+        memcpy(out, words + GLGE_FLIGHT_RECORDER_HEADER_WORDS, length);
+        out += length;
+        *out++ = '\n';
+        __flightRecorderWrite(fd, line, (uint64_t)(out - line));
+        ++written;
+    }
+    return written;
+}
+
+void s_FlightRecorder::installCrashHandler(int fd, uint64_t maxRecords) noexcept
+{
+    __flightRecorderCrashFd.store(fd, std::memory_order_relaxed);
+    __flightRecorderCrashMax.store(maxRecords, std::memory_order_relaxed);
+    __flightRecorderCrash.store(this, std::memory_order_release);
+
+    //the handlers of the application are saved only once, a second installation would save the own handler
+    if (__flightRecorderInstalled.exchange(true)) {return;}
+    for (uint32_t i = 0; i < GLGE_FLIGHT_RECORDER_SIGNAL_COUNT; ++i)
+    {
+        int sig = __flightRecorderSignals[i];
+        #if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+        __flightRecorderPrevious[i] = signal(sig, __flightRecorderSignalPlain);
+        #else
+        //run on the alternate stack if there is one, so stack overflows can be dumped too
+        struct sigaction action;
+        memset(&action, 0, sizeof(action));
+        action.sa_sigaction = __flightRecorderSignalInfo;
+        sigemptyset(&action.sa_mask);
+        action.sa_flags = SA_ONSTACK | SA_SIGINFO;
+        sigaction(sig, &action, &__flightRecorderPrevious[i]);
+        #endif
+    }
+}
+
+extern "C" {
+
+FlightRecorder* flightRecorder_Create(const FlightRecorderCreateInfo* info) {return new FlightRecorder(*info);}
+
+void flightRecorder_Destroy(FlightRecorder* recorder) {delete recorder;}
+
+void flightRecorder_Record(LogLevel level, const char* text, FlightRecorder* recorder) {recorder->record(level, text, strlen(text));}
+
+uint64_t flightRecorder_Dump(int fd, uint64_t maxRecords, const FlightRecorder* recorder) {return recorder->dump(fd, maxRecords);}
+
+void flightRecorder_InstallCrashHandler(int fd, uint64_t maxRecords, FlightRecorder* recorder) {recorder->installCrashHandler(fd, maxRecords);}
+
+}
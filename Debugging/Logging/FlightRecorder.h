@@ -0,0 +1,242 @@
+/**
+ * @file FlightRecorder.h
+ * @author DM8AT
+ * @brief define a fixed-memory ring of the most recent log messages that can be dumped from a crash handler
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_BG_FLIGHT_RECORDER_
+#define _GLGE_BG_FLIGHT_RECORDER_
+
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+//formatted messages take a variable argument list
+#include <stdarg.h>
+
+//the records store the level of their message
+#include "LogLevel.h"
+
+//include atomics for C++
+#if __cplusplus
+#include <atomic>
+#endif
+
+/**
+ * @brief the size of a single record in bytes if none is specified
+ */
+#define GLGE_FLIGHT_RECORDER_DEFAULT_RECORD_SIZE 256
+/**
+ * @brief the amount of records per ring if none is specified
+ */
+#define GLGE_FLIGHT_RECORDER_DEFAULT_RECORD_COUNT 4096
+/**
+ * @brief the maximum size of a single record in bytes. Limited, as dumps copy a record to the stack of the signal handler.
+ */
+#define GLGE_FLIGHT_RECORDER_MAX_RECORD_SIZE 1024
+/**
+ * @brief the maximum amount of rings of a flight recorder
+ */
+#define GLGE_FLIGHT_RECORDER_MAX_RINGS 64
+
+/**
+ * @brief store the options a flight recorder is created with. Zero-initialized members use their default.
+ */
+typedef struct s_FlightRecorderCreateInfo {
+    /**
+     * @brief the size of a single record in bytes, including a 24 byte header. Longer messages are cut. 0 means
+     * GLGE_FLIGHT_RECORDER_DEFAULT_RECORD_SIZE. Rounded up to a multiple of 8 and clamped to 64 - GLGE_FLIGHT_RECORDER_MAX_RECORD_SIZE.
+     */
+    uint64_t recordSize;
+    /**
+     * @brief the amount of records each ring keeps. 0 means GLGE_FLIGHT_RECORDER_DEFAULT_RECORD_COUNT. Rounded up to a power of two.
+     */
+    uint64_t recordCount;
+    /**
+     * @brief the amount of rings, at most GLGE_FLIGHT_RECORDER_MAX_RINGS. 0 or 1 means a single ring shared by all threads.
+     * More rings are handed out to the logging threads round-robin, so each thread records into its own ring while there
+     * are enough rings.
+     */
+    uint32_t ringCount;
+} FlightRecorderCreateInfo;
+
+//a single ring is only known to the implementation
+#if __cplusplus
+struct FlightRecorderRing;
+#endif
+
+/**
+ * @brief store a fixed amount of the most recent log messages
+ * 
+ * All memory is allocated on creation. Recording a message never performs I/O or allocates, the oldest records are
+ * overwritten. The last records can be dumped to a file descriptor at any time, also from a signal handler.
+ */
+typedef struct s_FlightRecorder {
+
+    //check for C++ to define the flight recorder
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new Flight Recorder
+     * 
+     * @param info the options of the recorder
+     */
+    s_FlightRecorder(const FlightRecorderCreateInfo& info);
+
+    /**
+     * @brief Destroy the Flight Recorder. Uninstalls the crash handler if it dumps this recorder.
+     */
+    ~s_FlightRecorder();
+
+    /**
+     * @brief record a message
+     * 
+     * @param level the level of the message
+     * @param text the message
+     * @param length the length of the message in bytes
+     * @param prefix true to prefix the text with the level, false if the text is already complete
+     */
+    void record(LogLevel level, const char* text, uint64_t length, bool prefix = true) noexcept;
+
+    /**
+     * @brief record a printf style message. It is formatted directly into the record.
+     * 
+     * @param level the level of the message. The text is prefixed with it.
+     * @param format the format string
+     * @param args the arguments for the format string
+     */
+    void recordFormatted(LogLevel level, const char* format, va_list args) noexcept;
+
+    /**
+     * @brief write the most recent records to a file descriptor, oldest first. Async-signal-safe.
+     * 
+     * Records that are overwritten while dumping are skipped.
+     * 
+     * @param fd the file descriptor to write to
+     * @param maxRecords the maximum amount of records to write
+     * @return uint64_t the amount of written records
+     */
+    uint64_t dump(int fd, uint64_t maxRecords) const noexcept;
+
+    /**
+     * @brief dump this recorder from a handler for fatal signals (SIGABRT, SIGSEGV, SIGBUS, SIGILL, SIGFPE)
+     * 
+     * The handlers the application installed before are kept. After the dump, they are restored and called, or, if
+     * there were none, the default handler is restored and the signal is raised again. Only one recorder can be
+     * installed, installing another one only changes the dumped recorder.
+     * 
+     * @param fd the file descriptor to dump to, e.g. 2 for stderr
+     * @param maxRecords the maximum amount of records to dump
+     */
+    void installCrashHandler(int fd, uint64_t maxRecords) noexcept;
+
+protected:
+
+    /**
+     * @brief get the ring of the calling thread
+     * 
+     * @return FlightRecorderRing& a reference to the ring to record into
+     */
+    FlightRecorderRing& ring() noexcept;
+
+    /**
+     * @brief store a record
+     * 
+     * @param words the record with its header, as words
+     * @param wordCount the amount of used words
+     */
+    void store(uint64_t* words, uint64_t wordCount) noexcept;
+
+    /**
+     * @brief the rings
+     */
+    FlightRecorderRing* m_rings = nullptr;
+    /**
+     * @brief the amount of rings
+     */
+    uint32_t m_ringCount = 1;
+    /**
+     * @brief the amount of words per record
+     */
+    uint64_t m_recordWords = 0;
+    /**
+     * @brief the amount of records per ring, a power of two
+     */
+    uint64_t m_recordCount = 0;
+    /**
+     * @brief the next ring to hand out to a thread
+     */
+    std::atomic<uint32_t> m_nextRing{0};
+
+    #else
+
+    //for windows, add a single byte here to make the struct contain something
+    uint8_t byte;
+
+    #endif
+
+    //for C, this is an opaque structure
+
+} FlightRecorder;
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief create a new flight recorder
+ * 
+ * @param info the options of the recorder
+ * @return FlightRecorder* a pointer to the new flight recorder
+ */
+FlightRecorder* flightRecorder_Create(const FlightRecorderCreateInfo* info);
+
+/**
+ * @brief destroy a flight recorder
+ * 
+ * @param recorder a pointer to the flight recorder to destroy
+ */
+void flightRecorder_Destroy(FlightRecorder* recorder);
+
+/**
+ * @brief record a message
+ * 
+ * @param level the level of the message
+ * @param text the message as a null terminated string
+ * @param recorder a pointer to the flight recorder to record into
+ */
+void flightRecorder_Record(LogLevel level, const char* text, FlightRecorder* recorder);
+
+/**
+ * @brief write the most recent records of a flight recorder to a file descriptor. Async-signal-safe.
+ * 
+ * @param fd the file descriptor to write to
+ * @param maxRecords the maximum amount of records to write
+ * @param recorder a pointer to the flight recorder to dump
+ * @return uint64_t the amount of written records
+ */
+uint64_t flightRecorder_Dump(int fd, uint64_t maxRecords, const FlightRecorder* recorder);
+
+/**
+ * @brief dump a flight recorder if the program receives a fatal signal
+ * 
+ * @param fd the file descriptor to dump to
+ * @param maxRecords the maximum amount of records to dump
+ * @param recorder a pointer to the flight recorder to dump
+ */
+void flightRecorder_InstallCrashHandler(int fd, uint64_t maxRecords, FlightRecorder* recorder);
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,277 @@
+/**
+ * @file LogCompression.cpp
+ * @author DM8AT
+ * @brief implement the LZ4 style block compressor and the frames
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the compression
+#include "LogCompression.h"
+
+//memory management stuff
+#include <cstring>
+#include <cstdio>
+#include <vector>
+
+/**
+ * @brief the amount of bits of the hash table index. 4096 entries keep the table in the L1 cache.
+ */
+#define GLGE_LOG_COMPRESSION_HASH_BITS 12
+
+/**
+ * @brief the minimum length of a match
+ */
+#define GLGE_LOG_COMPRESSION_MIN_MATCH 4
+
+/**
+ * @brief the last bytes of a block are always literals, as required by the LZ4 block format
+ */
+#define GLGE_LOG_COMPRESSION_LAST_LITERALS 5
+
+/**
+ * @brief no match may start in the last bytes of a block, as required by the LZ4 block format
+ */
+#define GLGE_LOG_COMPRESSION_MATCH_LIMIT 12
+
+/**
+ * @brief read 4 unaligned bytes
+ * 
+ * @param ptr the bytes to read
+ * @return uint32_t the bytes as integer
+ */
+static inline uint32_t __logCompressionRead32(const uint8_t* ptr)
+{
+    uint32_t value;
+    memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief write a 32 bit integer as little endian
+ * 
+ * @param ptr the memory to write to
+ * @param value the value to write
+ */
+static inline void __logCompressionWriteLE32(uint8_t* ptr, uint32_t value)
+{
+    ptr[0] = (uint8_t)value;
+    ptr[1] = (uint8_t)(value >> 8);
+    ptr[2] = (uint8_t)(value >> 16);
+    ptr[3] = (uint8_t)(value >> 24);
+}
+
+/**
+ * @brief read a 32 bit little endian integer
+ * 
+ * @param ptr the memory to read from
+ * @return uint32_t the value
+ */
+static inline uint32_t __logCompressionReadLE32(const uint8_t* ptr)
+{return (uint32_t)ptr[0] | ((uint32_t)ptr[1] << 8) | ((uint32_t)ptr[2] << 16) | ((uint32_t)ptr[3] << 24);}
+
+/**
+ * @brief write a length that does not fit into the token
+ * 
+ * @param out the position to write to
+ * @param length the remaining length, after subtracting 15 for the token
+ * @return uint8_t* the position after the length
+ */
+static inline uint8_t* __logCompressionWriteLength(uint8_t* out, uint64_t length)
+{
+    while (length >= 255) {*out++ = 255; length -= 255;}
+    *out++ = (uint8_t)length;
+    return out;
+}
+
+/**
+ * @brief write a sequence: literals followed by an optional match
+ * 
+ * @param out the position to write to
+ * @param literals the literals
+ * @param literalLength the amount of literals
+ * @param offset the distance of the match or 0 for the last sequence without match
+ * @param matchLength the length of the match
+ * @return uint8_t* the position after the sequence
+ */
+static uint8_t* __logCompressionSequence(uint8_t* out, const uint8_t* literals, uint64_t literalLength, uint32_t offset, uint64_t matchLength)
+{
+    uint8_t* token = out++;
+    uint64_t matchCode = (offset != 0) ? matchLength - GLGE_LOG_COMPRESSION_MIN_MATCH : 0;
+    *token = (uint8_t)(((literalLength < 15) ? literalLength : 15) << 4);
+    if (literalLength >= 15) {out = __logCompressionWriteLength(out, literalLength - 15);}
+    memcpy(out, literals, literalLength);
+    out += literalLength;
+    if (offset == 0) {return out;}
+
+    out[0] = (uint8_t)offset;
+    out[1] = (uint8_t)(offset >> 8);
+    out += 2;
+    *token |= (uint8_t)((matchCode < 15) ? matchCode : 15);
+    if (matchCode >= 15) {out = __logCompressionWriteLength(out, matchCode - 15);}
+    return out;
+}
+
+extern "C" {
+
+uint64_t logCompression_Bound(uint64_t size) {return size + size / 255 + 16;}
+
+uint64_t logCompression_CompressBlock(const void* src, uint64_t size, void* dst)
+{
+    const uint8_t* in = (const uint8_t*)src;
+    uint8_t* out = (uint8_t*)dst;
+    uint64_t anchor = 0;
+
+    if (size > GLGE_LOG_COMPRESSION_MATCH_LIMIT)
+    {
+        //the table stores the last position of each hashed 4 byte sequence
+        uint32_t table[1u << GLGE_LOG_COMPRESSION_HASH_BITS];
+        memset(table, 0, sizeof(table));
+        uint64_t limit = size - GLGE_LOG_COMPRESSION_MATCH_LIMIT;
+        uint64_t matchEnd = size - GLGE_LOG_COMPRESSION_LAST_LITERALS;
+        uint64_t ip = 0;
+
+        while (ip < limit)
+        {
+            uint32_t sequence = __logCompressionRead32(in + ip);
+            uint32_t hash = (sequence * 2654435761u) >> (32 - GLGE_LOG_COMPRESSION_HASH_BITS);
+            uint64_t ref = table[hash];
+            table[hash] = (uint32_t)ip;
+
+            //the reference must be in the 64 KiB window and really match
+            if ((ref >= ip) || (ip - ref > 0xFFFF) || (__logCompressionRead32(in + ref) != sequence))
+            {
+                //skip faster through data that does not compress
+                ip += 1 + ((ip - anchor) >> 6);
+                continue;
+            }
+
+            //extend the match backwards over the literals and forwards as far as possible
+            while ((ip > anchor) && (ref > 0) && (in[ip - 1] == in[ref - 1])) {--ip; --ref;}
+            uint64_t length = GLGE_LOG_COMPRESSION_MIN_MATCH;
+            while ((ip + length < matchEnd) && (in[ref + length] == in[ip + length])) {++length;}
+
+            out = __logCompressionSequence(out, in + anchor, ip - anchor, (uint32_t)(ip - ref), length);
+            ip += length;
+            anchor = ip;
+        }
+    }
+
+    //the rest is stored as literals
+    out = __logCompressionSequence(out, in + anchor, size - anchor, 0, 0);
+    return (uint64_t)(out - (uint8_t*)dst);
+}
+
+int64_t logCompression_DecompressBlock(const void* src, uint64_t size, void* dst, uint64_t capacity)
+{
+    const uint8_t* in = (const uint8_t*)src;
+    const uint8_t* inEnd = in + size;
+    uint8_t* out = (uint8_t*)dst;
+    uint8_t* outEnd = out + capacity;
+
+    while (in < inEnd)
+    {
+        uint8_t token = *in++;
+
+        //copy the literals
+        uint64_t length = token >> 4;
+        if (length == 15)
+        {
+            uint8_t extra;
+            do {
+                if (in >= inEnd) {return -1;}
+                extra = *in++;
+                length += extra;
+            } while (extra == 255);
+        }
+        if (((uint64_t)(inEnd - in) < length) || ((uint64_t)(outEnd - out) < length)) {return -1;}
+        memcpy(out, in, length);
+        in += length;
+        out += length;
+
+        //the last sequence has no match
+        if (in == inEnd) {break;}
+
+        //copy the match. It may overlap with its own output, so it is copied byte wise.
+        if (inEnd - in < 2) {return -1;}
+        uint64_t offset = (uint64_t)in[0] | ((uint64_t)in[1] << 8);
+        in += 2;
+        if ((offset == 0) || (offset > (uint64_t)(out - (uint8_t*)dst))) {return -1;}
+        length = (token & 15);
+        if (length == 15)
+        {
+            uint8_t extra;
+            do {
+                if (in >= inEnd) {return -1;}
+                extra = *in++;
+                length += extra;
+            } while (extra == 255);
+        }
+        length += GLGE_LOG_COMPRESSION_MIN_MATCH;
+        if ((uint64_t)(outEnd - out) < length) {return -1;}
+        const uint8_t* match = out - offset;
+        if (offset >= length) {memcpy(out, match, length); out += length;}
+        else {for (uint64_t i = 0; i < length; ++i) {*out++ = *match++;}}
+    }
+
+    return (int64_t)(out - (uint8_t*)dst);
+}
+
+uint64_t logCompression_WriteFrame(const void* src, uint64_t size, void* dst)
+{
+    uint8_t* out = (uint8_t*)dst;
+    uint64_t stored = logCompression_CompressBlock(src, size, out + GLGE_LOG_FRAME_HEADER_SIZE);
+    uint32_t storedField = (uint32_t)stored;
+    //data that does not get smaller is stored as it is
+    if (stored >= size)
+    {
+        memcpy(out + GLGE_LOG_FRAME_HEADER_SIZE, src, size);
+        stored = size;
+        storedField = (uint32_t)size | GLGE_LOG_FRAME_UNCOMPRESSED;
+    }
+    __logCompressionWriteLE32(out, GLGE_LOG_FRAME_MAGIC);
+    __logCompressionWriteLE32(out + 4, (uint32_t)size);
+    __logCompressionWriteLE32(out + 8, storedField);
+    return GLGE_LOG_FRAME_HEADER_SIZE + stored;
+}
+
+bool logCompression_DecompressFile(const char* path, void (*func)(const char* data, uint64_t size, void* userData), void* userData)
+{
+    FILE* file = fopen(path, "rb");
+    if (!file) {return false;}
+
+    //the buffers grow to the largest frame of the file
+    std::vector<uint8_t> stored, raw;
+    uint8_t header[GLGE_LOG_FRAME_HEADER_SIZE];
+    bool valid = true;
+    while (true)
+    {
+        size_t n = fread(header, 1, sizeof(header), file);
+        if (n == 0) {break;}
+        if ((n != sizeof(header)) || (__logCompressionReadLE32(header) != GLGE_LOG_FRAME_MAGIC)) {valid = false; break;}
+        uint32_t rawSize = __logCompressionReadLE32(header + 4);
+        uint32_t storedField = __logCompressionReadLE32(header + 8);
+        uint32_t storedSize = storedField & ~GLGE_LOG_FRAME_UNCOMPRESSED;
+        if ((rawSize > GLGE_LOG_FRAME_MAX_SIZE) || (storedSize > logCompression_Bound(rawSize))) {valid = false; break;}
+
+        stored.resize(storedSize);
+        if (fread(stored.data(), 1, storedSize, file) != storedSize) {valid = false; break;}
+        if (storedField & GLGE_LOG_FRAME_UNCOMPRESSED)
+        {
+            if (storedSize != rawSize) {valid = false; break;}
+            (*func)((const char*)stored.data(), storedSize, userData);
+            continue;
+        }
+        raw.resize(rawSize);
+        if (logCompression_DecompressBlock(stored.data(), storedSize, raw.data(), rawSize) != (int64_t)rawSize) {valid = false; break;}
+        (*func)((const char*)raw.data(), rawSize, userData);
+    }
+
+    fclose(file);
+    return valid;
+}
+
+}
@@ -0,0 +1,102 @@
+/**
+ * @file LogCompression.h
+ * @author DM8AT
+ * @brief define a fast LZ4 style block compressor and the framing used for compressed log files
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_BG_LOG_COMPRESSION_
+#define _GLGE_BG_LOG_COMPRESSION_
+
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+/**
+ * @brief the magic number every frame starts with ("GLZ1" in little endian)
+ */
+#define GLGE_LOG_FRAME_MAGIC 0x315A4C47u
+
+/**
+ * @brief the size of the header of a frame: the magic, the raw size and the stored size, each as 32 bit little endian
+ */
+#define GLGE_LOG_FRAME_HEADER_SIZE 12
+
+/**
+ * @brief the bit of the stored size that marks a frame whose data is stored uncompressed
+ */
+#define GLGE_LOG_FRAME_UNCOMPRESSED 0x80000000u
+
+/**
+ * @brief the maximum amount of raw bytes in a single frame
+ */
+#define GLGE_LOG_FRAME_MAX_SIZE (64u*1024u*1024u)
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief get the maximum size a block can have after compression
+ * 
+ * @param size the size of the uncompressed block
+ * @return uint64_t the maximum size of the compressed block
+ */
+uint64_t logCompression_Bound(uint64_t size);
+
+/**
+ * @brief compress a block. The output follows the LZ4 block format.
+ * 
+ * @param src the data to compress
+ * @param size the size of the data in bytes
+ * @param dst the memory to write the compressed block to. Must hold at least logCompression_Bound(size) bytes.
+ * @return uint64_t the size of the compressed block
+ */
+uint64_t logCompression_CompressBlock(const void* src, uint64_t size, void* dst);
+
+/**
+ * @brief decompress a block. Invalid data is detected, it never causes an access outside of the buffers.
+ * 
+ * @param src the compressed block
+ * @param size the size of the compressed block in bytes
+ * @param dst the memory to write the data to
+ * @param capacity the size of the memory in bytes
+ * @return int64_t the size of the decompressed data or -1 if the block is invalid or does not fit
+ */
+int64_t logCompression_DecompressBlock(const void* src, uint64_t size, void* dst, uint64_t capacity);
+
+/**
+ * @brief compress data into a single frame. Data that does not compress is stored uncompressed.
+ * 
+ * @param src the data to compress. At most GLGE_LOG_FRAME_MAX_SIZE bytes.
+ * @param size the size of the data in bytes
+ * @param dst the memory to write the frame to. Must hold at least GLGE_LOG_FRAME_HEADER_SIZE + logCompression_Bound(size) bytes.
+ * @return uint64_t the size of the frame
+ */
+uint64_t logCompression_WriteFrame(const void* src, uint64_t size, void* dst);
+
+/**
+ * @brief decompress a file made of frames, e.g. a log file written by a compressing file sink
+ * 
+ * @param path the path of the compressed file
+ * @param func the function that receives the decompressed data, frame by frame
+ * @param userData the user data to pass to the function
+ * @return true : the whole file was decompressed
+ * @return false : the file could not be opened or contains an invalid frame
+ */
+bool logCompression_DecompressFile(const char* path, void (*func)(const char* data, uint64_t size, void* userData), void* userData);
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+#endif
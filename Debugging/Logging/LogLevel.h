@@ -0,0 +1,100 @@
+/**
+ * @file LogLevel.h
+ * @author DM8AT
+ * @brief define the severities of log messages and the compile-time minimum level
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_BG_LOG_LEVEL_
+#define _GLGE_BG_LOG_LEVEL_
+
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+/**
+ * @brief the lowest level that is compiled in. Messages with a lower level expand to nothing, their arguments are never
+ * evaluated. Uses the numeric values of LogLevel (1 = trace ... 6 = fatal, 7 = nothing). Defaults to trace for debug
+ * builds and to info for all other builds.
+ */
+#ifndef GLGE_LOG_MIN_LEVEL
+#if GLGE_BG_DEBUG
+#define GLGE_LOG_MIN_LEVEL 1
+#else
+#define GLGE_LOG_MIN_LEVEL 3
+#endif
+#endif
+
+/**
+ * @brief the category all messages without a special category use
+ */
+#define GLGE_LOG_CATEGORY_DEFAULT 0
+/**
+ * @brief the amount of categories a logger can filter. Categories are numbered from 0 to GLGE_LOG_CATEGORY_COUNT-1.
+ */
+#define GLGE_LOG_CATEGORY_COUNT 32
+
+/**
+ * @brief define the severity of a log message
+ */
+typedef enum e_LogLevel {
+    /**
+     * @brief the message has no level. Used by messages that are not logged through the level macros.
+     */
+    GLGE_LOG_LEVEL_NONE = 0,
+    /**
+     * @brief very detailed information to follow the control flow
+     */
+    GLGE_LOG_LEVEL_TRACE = 1,
+    /**
+     * @brief information that is only interesting while debugging
+     */
+    GLGE_LOG_LEVEL_DEBUG = 2,
+    /**
+     * @brief general information about the state of the program
+     */
+    GLGE_LOG_LEVEL_INFO = 3,
+    /**
+     * @brief something unexpected happened, but the program can continue normally
+     */
+    GLGE_LOG_LEVEL_WARNING = 4,
+    /**
+     * @brief an operation failed
+     */
+    GLGE_LOG_LEVEL_ERROR = 5,
+    /**
+     * @brief the program can't continue
+     */
+    GLGE_LOG_LEVEL_FATAL = 6,
+    /**
+     * @brief used as minimum level to disable all messages
+     */
+    GLGE_LOG_LEVEL_OFF = 7
+} LogLevel;
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief get the prefix messages of a level start with
+ * 
+ * @param level the level to get the prefix for
+ * @return const char* the prefix, like "[INFO] ". An empty string for GLGE_LOG_LEVEL_NONE.
+ */
+const char* logLevel_Prefix(LogLevel level);
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,79 @@
+/**
+ * @file LogLimiter.cpp
+ * @author DM8AT
+ * @brief implement the rate limiting and sampling of log messages
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the log limiter
+#include "LogLimiter.h"
+
+//the rate limit uses a monotonic clock
+#include <chrono>
+
+/**
+ * @brief get the current time of the monotonic clock
+ * 
+ * @return uint64_t the time in nanoseconds
+ */
+static inline uint64_t __logLimiterNow()
+{return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();}
+
+/**
+ * @brief get a random number for the sampling. Each thread has its own generator, so no synchronization is needed.
+ * 
+ * @return uint32_t a pseudo random number
+ */
+static inline uint32_t __logLimiterRandom()
+{
+    //seed every thread differently using the address of its generator state
+    static thread_local uint64_t state = 0;
+    if (state == 0) {state = (uint64_t)(uintptr_t)&state ^ __logLimiterNow() ^ 0x9E3779B97F4A7C15ull;}
+    //xorshift64*
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return (uint32_t)((state * 0x2545F4914F6CDD1Dull) >> 32);
+}
+
+extern "C" {
+
+void logLimiter_Init(uint32_t perSecond, uint32_t burst, uint32_t sampleEvery, bool randomSample, LogLimiter* limiter)
+{*limiter = GLGE_LOG_LIMITER_INIT(perSecond, burst, sampleEvery, randomSample);}
+
+bool logLimiter_Allow(uint32_t* suppressed, LogLimiter* limiter)
+{
+    //sampling drops the messages silently
+    if (limiter->sampleEvery > 1)
+    {
+        uint32_t n = limiter->randomSample ? __logLimiterRandom() : atomic32_Fetch_add(1, GLGE_ATOMIC_RELAXED, &limiter->sampleCounter);
+        if ((n % limiter->sampleEvery) != 0) {return false;}
+    }
+
+    //the rate limit: each message moves the time the bucket is full again by one interval. If that time is too far in
+    //the future, the bucket is empty.
+    if (limiter->interval)
+    {
+        uint64_t now = __logLimiterNow();
+        uint64_t fullAt = atomic64_Load(GLGE_ATOMIC_RELAXED, &limiter->fullAt);
+        uint64_t next;
+        do {
+            if (fullAt > now + limiter->tolerance)
+            {
+                atomic32_Fetch_add(1, GLGE_ATOMIC_RELAXED, &limiter->suppressed);
+                return false;
+            }
+            next = ((fullAt > now) ? fullAt : now) + limiter->interval;
+        } while (!atomic64_Compare_exchange_weak(&fullAt, next, GLGE_ATOMIC_RELAXED, GLGE_ATOMIC_RELAXED, &limiter->fullAt));
+    }
+
+    //the message passes and reports the dropped messages
+    *suppressed = (atomic32_Load(GLGE_ATOMIC_RELAXED, &limiter->suppressed) == 0) ? 0 : atomic32_Exchange(0, GLGE_ATOMIC_RELAXED, &limiter->suppressed);
+    return true;
+}
+
+}
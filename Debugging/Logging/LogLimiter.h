@@ -0,0 +1,111 @@
+/**
+ * @file LogLimiter.h
+ * @author DM8AT
+ * @brief define per-call-site rate limiting and sampling of log messages
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_BG_LOG_LIMITER_
+#define _GLGE_BG_LOG_LIMITER_
+
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+//the state of a limiter is shared by all threads executing the call site
+#include "../../CBinding/Atomic.h"
+
+/**
+ * @brief calculate the nanoseconds between two messages for a rate in messages per second. 0 means no limit.
+ */
+#define GLGE_LOG_LIMITER_INTERVAL(perSecond) (((perSecond) > 0) ? (1000000000ull / (uint64_t)(perSecond)) : 0ull)
+
+/**
+ * @brief initialize a log limiter on declaration, e.g. static LogLimiter limiter = GLGE_LOG_LIMITER_INIT(10, 20, 0, false);
+ * 
+ * @param perSecond the amount of messages per second that are let through on average. 0 disables the rate limit.
+ * @param burst the amount of messages that can pass at once after a quiet period. 0 is treated as 1.
+ * @param sampleEvery only let one of this many messages through. 0 and 1 disable sampling.
+ * @param randomSample true : each message passes with a chance of 1 / sampleEvery | false : exactly every sampleEvery-th message passes
+ */
+#define GLGE_LOG_LIMITER_INIT(perSecond, burst, sampleEvery, randomSample) { \
+    GLGE_LOG_LIMITER_INTERVAL(perSecond), GLGE_LOG_LIMITER_INTERVAL(perSecond) * (((burst) > 1) ? (uint64_t)(burst) - 1 : 0ull), \
+    GLGE_ATOMIC_INIT(0), GLGE_ATOMIC_INIT(0), GLGE_ATOMIC_INIT(0), (uint32_t)(sampleEvery), (randomSample)}
+
+/**
+ * @brief store the state of a rate limited and / or sampled call site
+ * 
+ * The rate limit is a token bucket stored as a single timestamp (the time the bucket is full again), so a message is
+ * checked with a single clock read and one compare-exchange. Messages that are dropped by the rate limit are counted
+ * and reported with the next message that passes. Messages dropped by sampling are not reported, as sampling is intended.
+ */
+typedef struct s_LogLimiter {
+    /**
+     * @brief the nanoseconds one token needs to refill or 0 if the rate is not limited
+     */
+    uint64_t interval;
+    /**
+     * @brief the nanoseconds of tokens that can be spent in advance, which allows bursts
+     */
+    uint64_t tolerance;
+    /**
+     * @brief the time in nanoseconds at which the bucket is full again
+     */
+    Atomic64 fullAt;
+    /**
+     * @brief counts the messages for deterministic sampling
+     */
+    Atomic32 sampleCounter;
+    /**
+     * @brief the amount of messages dropped by the rate limit since the last message passed
+     */
+    Atomic32 suppressed;
+    /**
+     * @brief only let one of this many messages through. 0 and 1 disable sampling.
+     */
+    uint32_t sampleEvery;
+    /**
+     * @brief true if the sampling is random instead of every n-th message
+     */
+    bool randomSample;
+} LogLimiter;
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief initialize a log limiter at runtime. Must not be called while the limiter is used.
+ * 
+ * @param perSecond the amount of messages per second that are let through on average. 0 disables the rate limit.
+ * @param burst the amount of messages that can pass at once after a quiet period. 0 is treated as 1.
+ * @param sampleEvery only let one of this many messages through. 0 and 1 disable sampling.
+ * @param randomSample true : each message passes with a chance of 1 / sampleEvery | false : exactly every sampleEvery-th message passes
+ * @param limiter the limiter to initialize
+ */
+void logLimiter_Init(uint32_t perSecond, uint32_t burst, uint32_t sampleEvery, bool randomSample, LogLimiter* limiter);
+
+/**
+ * @brief check if a message may pass a limiter. Dropped messages only cost this check.
+ * 
+ * @param suppressed filled with the amount of messages the rate limit dropped since the last message passed. Only set if the message passes.
+ * @param limiter the limiter to check
+ * @return true : the message should be logged
+ * @return false : the message is dropped
+ */
+bool logLimiter_Allow(uint32_t* suppressed, LogLimiter* limiter);
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,192 @@
+/**
+ * @file LogSink.cpp
+ * @author DM8AT
+ * @brief implement log sinks and the batches shared between them
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include log sinks
+#include "LogSink.h"
+
+//include printing stuff
+#include <iostream>
+//memory management stuff
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+/**
+ * @brief store a batch that is shared between the sinks of a logger
+ * 
+ * The entries and the text are stored directly after the header in the same allocation.
+ */
+struct LogSharedBatch
+{
+    /**
+     * @brief the amount of sinks that did not write the batch yet
+     */
+    std::atomic<uint32_t> references;
+    /**
+     * @brief the batch, pointing into the same allocation
+     */
+    LogBatch batch;
+};
+
+LogSharedBatch* logSharedBatch_Create(const LogBatch& batch, uint32_t references)
+{
+    //a single allocation for the header, the entries and the text
+    uint64_t entryBytes = batch.count * sizeof(LogBatchEntry);
+    uint8_t* memory = (uint8_t*)::operator new(sizeof(LogSharedBatch) + entryBytes + batch.textSize);
+    LogSharedBatch* shared = new (memory) LogSharedBatch;
+    shared->references.store(references, std::memory_order_relaxed);
+    LogBatchEntry* entries = (LogBatchEntry*)(memory + sizeof(LogSharedBatch));
+    char* text = (char*)(memory + sizeof(LogSharedBatch) + entryBytes);
+    memcpy(entries, batch.entries, entryBytes);
+    memcpy(text, batch.text, batch.textSize);
+    shared->batch = {text, batch.textSize, entries, batch.count};
+    return shared;
+}
+
+void logSharedBatch_Release(LogSharedBatch* batch)
+{
+    if (batch->references.fetch_sub(1, std::memory_order_acq_rel) != 1) {return;}
+    batch->~LogSharedBatch();
+    ::operator delete((void*)batch);
+}
+
+s_LogSink::s_LogSink(const LogSinkCreateInfo& info)
+ : m_info(info)
+{
+    //fill in the defaults
+    if (!m_info.write) {m_info.write = logSink_WriteConsole; m_info.flush = logSink_FlushConsole;}
+    if (m_info.capacity == 0) {m_info.capacity = GLGE_LOG_SINK_DEFAULT_CAPACITY;}
+    m_worker = new Thread(workerMain, this);
+}
+
+s_LogSink::~s_LogSink()
+{
+    //let the worker write everything that is queued, then stop it
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_stop = true;
+        m_workCond.notify_one();
+    }
+    delete m_worker;
+}
+
+void s_LogSink::push(LogSharedBatch* batch)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if ((m_queue.size() >= m_info.capacity) && (m_info.backPressure != GLGE_LOGGER_GROW))
+    {
+        //a dropping sink never slows down the logger
+        if (m_info.backPressure == GLGE_LOGGER_DROP)
+        {
+            lock.unlock();
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            logSharedBatch_Release(batch);
+            return;
+        }
+        //a blocking sink waits for its worker
+        while (m_queue.size() >= m_info.capacity) {m_writtenCond.wait(lock);}
+    }
+    m_queue.push_back(batch);
+    ++m_pushed;
+    m_workCond.notify_one();
+}
+
+void s_LogSink::flush()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        uint64_t target = m_pushed;
+        while (m_written < target) {m_writtenCond.wait(lock);}
+    }
+    if (m_info.flush) {(*m_info.flush)(m_info.userData);}
+}
+
+void s_LogSink::workerMain(void* data)
+{
+    s_LogSink* sink = (s_LogSink*)data;
+    //the buffers for batches that are only partially received
+    std::string text;
+    std::vector<LogBatchEntry> entries;
+
+    std::unique_lock<std::mutex> lock(sink->m_mutex);
+    while (true)
+    {
+        if (sink->m_queue.empty())
+        {
+            if (sink->m_stop) {break;}
+            sink->m_workCond.wait(lock);
+            continue;
+        }
+        LogSharedBatch* shared = sink->m_queue.front();
+        sink->m_queue.pop_front();
+        lock.unlock();
+
+        //write the shared text directly if the sink receives all messages, else only copy the received ones
+        const LogBatch& batch = shared->batch;
+        uint64_t accepted = 0;
+        for (uint64_t i = 0; i < batch.count; ++i) {accepted += sink->accepts(batch.entries[i].level) ? 1 : 0;}
+        if (accepted == batch.count) {(*sink->m_info.write)(&batch, sink->m_info.userData);}
+        else if (accepted != 0)
+        {
+            text.clear();
+            entries.clear();
+            for (uint64_t i = 0; i < batch.count; ++i)
+            {
+                const LogBatchEntry& entry = batch.entries[i];
+                if (!sink->accepts(entry.level)) {continue;}
+                entries.push_back({text.size(), entry.length, entry.level});
+                text.append(batch.text + entry.offset, entry.length + 1);
+            }
+            LogBatch filtered{text.data(), text.size(), entries.data(), entries.size()};
+            (*sink->m_info.write)(&filtered, sink->m_info.userData);
+        }
+        logSharedBatch_Release(shared);
+
+        //signal flushes and blocked producers
+        lock.lock();
+        ++sink->m_written;
+        sink->m_writtenCond.notify_all();
+    }
+}
+
+extern "C" {
+
+void logSink_WriteConsole(const LogBatch* batch, void*)
+{std::cout.write(batch->text, (std::streamsize)batch->textSize);}
+
+void logSink_FlushConsole(void*) {std::cout.flush();}
+
+void logSink_WriteFile(const LogBatch* batch, void* userData)
+{
+    //the highest level of the batch decides about an immediate write
+    uint32_t level = GLGE_LOG_LEVEL_NONE;
+    for (uint64_t i = 0; i < batch->count; ++i) {level = (batch->entries[i].level > level) ? batch->entries[i].level : level;}
+    ((FileSink*)userData)->write(batch->text, batch->textSize, (LogLevel)level);
+}
+
+void logSink_FlushFile(void* userData) {((FileSink*)userData)->flush();}
+
+void logSink_WriteFlightRecorder(const LogBatch* batch, void* userData)
+{
+    FlightRecorder* recorder = (FlightRecorder*)userData;
+    for (uint64_t i = 0; i < batch->count; ++i)
+    {
+        //the text already carries the prefix it needs, so it is recorded as is. Structured events stay plain JSON
+        //lines and the dump looks the same as for a logger that records directly.
+        const LogBatchEntry& entry = batch->entries[i];
+        recorder->record((LogLevel)entry.level, batch->text + entry.offset, entry.length, false);
+    }
+}
+
+uint64_t logSink_DroppedCount(const LogSink* sink) {return sink->droppedCount();}
+
+}
@@ -0,0 +1,334 @@
+/**
+ * @file LogSink.h
+ * @author DM8AT
+ * @brief define log sinks that receive the batches of a logger on their own worker thread
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_BG_LOG_SINK_
+#define _GLGE_BG_LOG_SINK_
+
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+//sinks filter by level
+#include "LogLevel.h"
+//files and flight recorders can be used as sinks
+#include "FileSink.h"
+#include "FlightRecorder.h"
+//each sink has its own worker thread
+#include "../../CBinding/Thread.h"
+
+//include atomics, mutexes and containers for C++
+#if __cplusplus
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#endif
+
+/**
+ * @brief the amount of batches a sink queues if no capacity is specified
+ */
+#define GLGE_LOG_SINK_DEFAULT_CAPACITY 64
+
+/**
+ * @brief the maximum amount of sinks a single logger can have
+ */
+#define GLGE_LOGGER_MAX_SINKS 8
+
+/**
+ * @brief define what an asynchronous logger does if its queue is full
+ */
+typedef enum e_LoggerBackPressure {
+    /**
+     * @brief the logging thread waits till the writer thread made space
+     */
+    GLGE_LOGGER_BLOCK = 0,
+    /**
+     * @brief the message is dropped and counted
+     */
+    GLGE_LOGGER_DROP,
+    /**
+     * @brief the message is stored in an unbounded overflow list
+     */
+    GLGE_LOGGER_GROW
+} LoggerBackPressure;
+
+/**
+ * @brief the position of a single message inside of a log batch
+ */
+typedef struct s_LogBatchEntry {
+    /**
+     * @brief the offset of the first character of the message in bytes
+     */
+    uint64_t offset;
+    /**
+     * @brief the length of the message in bytes, without the new line
+     */
+    uint64_t length;
+    /**
+     * @brief the LogLevel of the message
+     */
+    uint32_t level;
+} LogBatchEntry;
+
+/**
+ * @brief store a batch of messages in a single contiguous buffer
+ * 
+ * All messages are stored back to back, each followed by a new line. The text is not null terminated, so the whole
+ * batch can be written with a single call.
+ */
+typedef struct s_LogBatch {
+    /**
+     * @brief the text of all messages
+     */
+    const char* text;
+    /**
+     * @brief the size of the text in bytes
+     */
+    uint64_t textSize;
+    /**
+     * @brief the positions of the messages in the text
+     */
+    const LogBatchEntry* entries;
+    /**
+     * @brief the amount of messages in the batch
+     */
+    uint64_t count;
+} LogBatch;
+
+/**
+ * @brief store the options a log sink is created with. Zero-initialized members use their default.
+ */
+typedef struct s_LogSinkCreateInfo {
+    /**
+     * @brief the function that writes a batch. Only called from the worker thread of the sink.
+     */
+    void (*write)(const LogBatch* batch, void* userData);
+    /**
+     * @brief an optional function that flushes the output. Called from the thread that flushes the logger.
+     */
+    void (*flush)(void* userData);
+    /**
+     * @brief the user data to pass to both functions
+     */
+    void* userData;
+    /**
+     * @brief the minimum level of the messages the sink receives. Messages without a level are always received.
+     */
+    LogLevel level;
+    /**
+     * @brief the maximum amount of batches the sink queues. 0 means GLGE_LOG_SINK_DEFAULT_CAPACITY.
+     */
+    uint32_t capacity;
+    /**
+     * @brief what to do if the queue of the sink is full
+     */
+    LoggerBackPressure backPressure;
+} LogSinkCreateInfo;
+
+//the shared batches are only known to the implementation
+#if __cplusplus
+struct LogSharedBatch;
+#endif
+
+/**
+ * @brief store a single output of a logger
+ * 
+ * A sink owns a queue of batches and a worker thread that writes them, so a slow sink does not block the logger or
+ * other sinks. The batches are shared between all sinks of a logger using a reference count, the text is never copied
+ * per sink.
+ */
+typedef struct s_LogSink {
+
+    //check for C++ to define the sink
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new Log Sink and start its worker thread
+     * 
+     * @param info the options of the sink
+     */
+    s_LogSink(const LogSinkCreateInfo& info);
+
+    /**
+     * @brief Destroy the Log Sink. All queued batches are written first.
+     */
+    ~s_LogSink();
+
+    /**
+     * @brief check if the sink receives messages of a level
+     * 
+     * @param level the level of the message
+     * @return true : the message is received
+     * @return false : the message is filtered out
+     */
+    inline bool accepts(uint32_t level) const noexcept {return (level == GLGE_LOG_LEVEL_NONE) || (level >= (uint32_t)m_info.level);}
+
+    /**
+     * @brief queue a shared batch. The sink takes one reference, which is released if the batch is dropped.
+     * 
+     * @param batch the batch to queue
+     */
+    void push(LogSharedBatch* batch);
+
+    /**
+     * @brief wait till all batches that are queued now are written, then flush the output
+     */
+    void flush();
+
+    /**
+     * @brief get the amount of batches that were dropped because the queue was full
+     * 
+     * @return uint64_t the amount of dropped batches
+     */
+    inline uint64_t droppedCount() const noexcept {return m_dropped.load(std::memory_order_relaxed);}
+
+protected:
+
+    /**
+     * @brief the function of the worker thread
+     * 
+     * @param sink the sink to write for
+     */
+    static void workerMain(void* sink);
+
+    /**
+     * @brief the options of the sink
+     */
+    LogSinkCreateInfo m_info;
+    /**
+     * @brief the queued batches
+     */
+    std::deque<LogSharedBatch*> m_queue;
+    /**
+     * @brief the amount of batches that were queued
+     */
+    uint64_t m_pushed = 0;
+    /**
+     * @brief the amount of batches that were written
+     */
+    uint64_t m_written = 0;
+    /**
+     * @brief the amount of dropped batches
+     */
+    std::atomic<uint64_t> m_dropped{0};
+    /**
+     * @brief true if the worker should stop once the queue is empty
+     */
+    bool m_stop = false;
+    /**
+     * @brief protects the queue and the counters
+     */
+    std::mutex m_mutex;
+    /**
+     * @brief wakes the worker thread
+     */
+    std::condition_variable m_workCond;
+    /**
+     * @brief signals that batches were written, used by flushes and blocked producers
+     */
+    std::condition_variable m_writtenCond;
+    /**
+     * @brief the worker thread
+     */
+    Thread* m_worker = nullptr;
+
+    #else
+
+    //for windows, add a single byte here to make the struct contain something
+    uint8_t byte;
+
+    #endif
+
+    //for C, this is an opaque structure
+
+} LogSink;
+
+//the shared batches are only used by the logger implementation
+#if __cplusplus
+
+/**
+ * @brief create a batch that can be shared between sinks. The text and the entries are copied once.
+ * 
+ * @param batch the batch to copy
+ * @param references the amount of sinks the batch is handed to
+ * @return LogSharedBatch* a pointer to the new batch
+ */
+LogSharedBatch* logSharedBatch_Create(const LogBatch& batch, uint32_t references);
+
+/**
+ * @brief release a reference of a shared batch. The batch is freed once no reference is left.
+ * 
+ * @param batch the batch to release
+ */
+void logSharedBatch_Release(LogSharedBatch* batch);
+
+#endif
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief a sink write function that prints the batch to the standard output. The user data is ignored.
+ * 
+ * @param batch the batch to print
+ * @param userData ignored
+ */
+void logSink_WriteConsole(const LogBatch* batch, void* userData);
+
+/**
+ * @brief a sink flush function that flushes the standard output. The user data is ignored.
+ * 
+ * @param userData ignored
+ */
+void logSink_FlushConsole(void* userData);
+
+/**
+ * @brief a sink write function that writes the batch to a file sink
+ * 
+ * @param batch the batch to write
+ * @param userData a pointer to the FileSink to write to
+ */
+void logSink_WriteFile(const LogBatch* batch, void* userData);
+
+/**
+ * @brief a sink flush function that flushes a file sink
+ * 
+ * @param userData a pointer to the FileSink to flush
+ */
+void logSink_FlushFile(void* userData);
+
+/**
+ * @brief a sink write function that records each message of the batch in a flight recorder
+ * 
+ * @param batch the batch to record
+ * @param userData a pointer to the FlightRecorder to record into
+ */
+void logSink_WriteFlightRecorder(const LogBatch* batch, void* userData);
+
+/**
+ * @brief get the amount of batches a sink dropped because its queue was full
+ * 
+ * @param sink the sink to quarry
+ * @return uint64_t the amount of dropped batches
+ */
+uint64_t logSink_DroppedCount(const LogSink* sink);
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+#endif
@@ -14,6 +14,331 @@
 
 //include printing stuff
 #include <iostream>
+//memory management stuff
+#include <cstring>
+
+//asynchronous loggers queue their messages for a writer thread
+#include "../../Threading/MPMCQueue.h"
+#include "../../CBinding/Thread.h"
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+#include <chrono>
+
+/**
+ * @brief the maximum amount of messages the writer thread prints in a single batch
+ */
+#define GLGE_LOGGER_BATCH_SIZE 256
+
+/**
+ * @brief append bytes to a byte vector, growing it exponentially
+ * 
+ * @param vec the vector to append to. The element size must be 1.
+ * @param data the bytes to append
+ * @param size the amount of bytes to append
+ */
+static void __loggerAppend(Vector& vec, const void* data, uint64_t size)
+{
+    if (vec.byteSize + size > vec.byteCapacity)
+    {
+        uint64_t capacity = (vec.byteCapacity < 256) ? 256 : vec.byteCapacity;
+        while (capacity < vec.byteSize + size) {capacity *= 2;}
+        vector_Reserve(capacity, &vec);
+    }
+    memcpy((uint8_t*)vec.ptr + vec.byteSize, data, size);
+    vec.byteSize += size;
+}
+
+/**
+ * @brief swap the contents of two vectors with the same element size
+ * 
+ * @param a the first vector
+ * @param b the second vector
+ */
+static void __loggerSwap(Vector& a, Vector& b)
+{
+    std::swap(a.ptr, b.ptr);
+    std::swap(a.byteSize, b.byteSize);
+    std::swap(a.byteCapacity, b.byteCapacity);
+}
+
+/**
+ * @brief store the state of an asynchronous logger
+ */
+struct LoggerAsync
+{
+    /**
+     * @brief Construct a new Logger Async state
+     * 
+     * @param capacity the minimum amount of messages the queue can hold
+     * @param _backPressure what to do if the queue is full
+     */
+    LoggerAsync(uint64_t capacity, LoggerBackPressure _backPressure)
+     : queue(sizeof(LogRecord), capacity), backPressure(_backPressure)
+    {}
+
+    /**
+     * @brief the queue of messages. Text messages are stored as a record without call site.
+     */
+    MPMCQueue queue;
+    /**
+     * @brief what to do if the queue is full
+     */
+    LoggerBackPressure backPressure;
+    /**
+     * @brief the messages that did not fit into the queue if the logger grows
+     */
+    std::deque<LogRecord> overflow;
+    /**
+     * @brief true if the overflow list is in use. Then all messages go there to keep them in order.
+     */
+    std::atomic<bool> overflowing{false};
+    /**
+     * @brief the amount of messages that were accepted
+     */
+    std::atomic<uint64_t> enqueued{0};
+    /**
+     * @brief the amount of messages that were printed. Only changed with the mutex locked.
+     */
+    std::atomic<uint64_t> printed{0};
+    /**
+     * @brief the amount of dropped messages
+     */
+    std::atomic<uint64_t> dropped{0};
+    /**
+     * @brief true if the writer thread waits for messages
+     */
+    std::atomic<bool> writerSleeping{false};
+    /**
+     * @brief true if the writer thread should stop once everything is printed
+     */
+    bool stop = false;
+    /**
+     * @brief protects the overflow list and the sleeping states
+     */
+    std::mutex mutex;
+    /**
+     * @brief wakes the writer thread
+     */
+    std::condition_variable writerCond;
+    /**
+     * @brief signals that messages were printed, used by flushes and blocked producers
+     */
+    std::condition_variable printedCond;
+    /**
+     * @brief the writer thread
+     */
+    Thread* writer = nullptr;
+    /**
+     * @brief the binary log file to write to or NULL to print the messages
+     */
+    BinaryLogWriter* binary = nullptr;
+
+    /**
+     * @brief wake the writer thread if it sleeps
+     */
+    inline void wake()
+    {
+        //pairs with the fence of the writer before it checks for messages
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!writerSleeping.load(std::memory_order_relaxed)) {return;}
+        std::lock_guard<std::mutex> guard(mutex);
+        writerCond.notify_one();
+    }
+
+    /**
+     * @brief check if there is something for the writer thread to do
+     * 
+     * @return true : there are messages queued
+     * @return false : there is nothing to print
+     */
+    inline bool hasWork() const noexcept {return (queue.size() != 0) || overflowing.load(std::memory_order_acquire);}
+
+    /**
+     * @brief add a message to the queue, respecting the back pressure mode
+     * 
+     * @param record the message. Ownership of an allocated text of a text message is taken.
+     */
+    void push(const LogRecord& record);
+
+    /**
+     * @brief turn a message into text
+     * 
+     * @param record the message to format
+     * @param out the string to write the text of deferred messages to
+     * @param length filled with the length of the text in bytes
+     * @param level filled with the level of the message
+     * @return const char* a pointer to the text of the message. Either the text of a text message or the data of out.
+     */
+    static const char* format(const LogRecord& record, String& out, uint64_t& length, LogLevel& level);
+
+    /**
+     * @brief the function of the writer thread
+     * 
+     * @param logger the logger to print for
+     */
+    static void writerMain(void* logger);
+};
+
+void LoggerAsync::push(const LogRecord& record)
+{
+    //the fast path: the queue has space and nothing waits in the overflow list
+    if (!overflowing.load(std::memory_order_acquire) && queue.push(&record))
+    {
+        enqueued.fetch_add(1, std::memory_order_release);
+        wake();
+        return;
+    }
+
+    switch (backPressure)
+    {
+    case GLGE_LOGGER_DROP:
+        logRecord_Release(&record);
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+
+    case GLGE_LOGGER_GROW:
+        {
+            std::lock_guard<std::mutex> guard(mutex);
+            overflow.push_back(record);
+            overflowing.store(true, std::memory_order_release);
+            enqueued.fetch_add(1, std::memory_order_release);
+        }
+        wake();
+        return;
+
+    default:
+        {
+            //wait till the writer made space. It notifies with the mutex locked, so the wake up can't be missed.
+            std::unique_lock<std::mutex> lock(mutex);
+            while (!queue.push(&record))
+            {
+                writerCond.notify_one();
+                printedCond.wait(lock);
+            }
+            enqueued.fetch_add(1, std::memory_order_release);
+        }
+        wake();
+        return;
+    }
+}
+
+const char* LoggerAsync::format(const LogRecord& record, String& out, uint64_t& length, LogLevel& level)
+{
+    //text messages carry their level in the flags
+    if (record.site == 0)
+    {
+        level = (LogLevel)(record.flags & GLGE_LOG_RECORD_LEVEL_MASK);
+        return logRecord_Text(&length, &record);
+    }
+    level = GLGE_LOG_LEVEL_NONE;
+    //deferred messages are formatted now
+    out.clear();
+    const LogCallSite* site = logCallSite_Get(record.site);
+    if (site)
+    {
+        level = (LogLevel)site->level;
+        out += logLevel_Prefix((LogLevel)site->level);
+        logRecord_Format(site->format, record.data.args, record.argBytes, &out);
+    }
+    length = out.size();
+    return out.data();
+}
+
+void LoggerAsync::writerMain(void* data)
+{
+    s_Logger* logger = (s_Logger*)data;
+    LoggerAsync* async = logger->m_async;
+    std::vector<LogRecord> batch;
+    batch.resize(GLGE_LOGGER_BATCH_SIZE);
+    std::string buffer;
+    std::vector<LogBatchEntry> entries;
+    String text;
+
+    while (true)
+    {
+        //take a batch from the queue. Only once the queue is empty, the overflow list is printed, so the order stays intact.
+        uint64_t count = async->queue.popBatch(batch.data(), GLGE_LOGGER_BATCH_SIZE);
+        std::deque<LogRecord> overflow;
+        if ((count == 0) && async->overflowing.load(std::memory_order_acquire))
+        {
+            std::lock_guard<std::mutex> guard(async->mutex);
+            overflow.swap(async->overflow);
+            async->overflowing.store(false, std::memory_order_release);
+        }
+
+        //sleep if there is nothing to do
+        if ((count == 0) && overflow.empty())
+        {
+            //the time trigger of the file sink can't wait for the next message, so check it while idle
+            uint64_t interval = logger->m_fileSink ? logger->m_fileSink->flushIntervalMs() : 0;
+            if (interval) {logger->m_fileSink->flushIfDue();}
+
+            std::unique_lock<std::mutex> lock(async->mutex);
+            async->writerSleeping.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!async->hasWork())
+            {
+                if (async->stop) {break;}
+                if (interval) {async->writerCond.wait_for(lock, std::chrono::milliseconds(interval));}
+                else {async->writerCond.wait(lock);}
+            }
+            async->writerSleeping.store(false, std::memory_order_relaxed);
+            continue;
+        }
+
+        //the messages of the queue are printed before the messages of the overflow list
+        uint64_t printed = count + overflow.size();
+        auto forEach = [&](auto func) {
+            for (uint64_t i = 0; i < count; ++i) {func(batch[i]);}
+            for (const LogRecord& record : overflow) {func(record);}
+        };
+
+        if (async->binary)
+        {
+            //binary logs store the records as they are
+            forEach([&](const LogRecord& record) {async->binary->write(record);});
+            async->binary->flush();
+        }
+        else
+        {
+            //format the whole batch into a single buffer
+            buffer.clear();
+            entries.clear();
+            forEach([&](const LogRecord& record) {
+                LogLevel level;
+                uint64_t length;
+                const char* str = format(record, text, length, level);
+                entries.push_back({buffer.size(), length, (uint32_t)level});
+                if (length) {buffer.append(str, (size_t)length);}
+                buffer += '\n';
+            });
+            logger->printBatch({buffer.data(), buffer.size(), entries.data(), entries.size()});
+        }
+        forEach([](const LogRecord& record) {logRecord_Release(&record);});
+
+        //signal flushes and blocked producers
+        std::lock_guard<std::mutex> guard(async->mutex);
+        async->printed.fetch_add(printed, std::memory_order_release);
+        async->printedCond.notify_all();
+    }
+}
+
+const char* logLevel_Prefix(LogLevel level)
+{
+    switch (level)
+    {
+    case GLGE_LOG_LEVEL_TRACE: return "[TRACE] ";
+    case GLGE_LOG_LEVEL_DEBUG: return "[DEBUG] ";
+    case GLGE_LOG_LEVEL_INFO: return "[INFO] ";
+    case GLGE_LOG_LEVEL_WARNING: return "[WARNING] ";
+    case GLGE_LOG_LEVEL_ERROR: return "[ERROR] ";
+    case GLGE_LOG_LEVEL_FATAL: return "[FATAL] ";
+    default: return "";
+    }
+}
 
 void logger_defaultPrint(String* str)
 {
@@ -23,47 +348,306 @@ void logger_defaultPrint(String* str)
     std::cout << str->c_str() << "\n" << std::flush;
 }
 
-void s_Logger::log(const char* string)
+s_Logger::s_Logger(uint64_t capacity, LoggerBackPressure backPressure, void (*func)(String*))
+ : toPrint(1), toPrintIndex(sizeof(LogBatchEntry)), mutex("logger"), autoPrint(false), print_func(func ? func : logger_defaultPrint), batch_func(nullptr)
+{
+    //start the writer thread
+    m_async = new LoggerAsync(capacity, backPressure);
+    m_async->writer = new Thread(LoggerAsync::writerMain, this);
+}
+
+s_Logger::s_Logger(const char* binaryPath, uint64_t capacity, LoggerBackPressure backPressure)
+ : toPrint(1), toPrintIndex(sizeof(LogBatchEntry)), mutex("logger"), autoPrint(false), print_func(logger_defaultPrint), batch_func(nullptr)
+{
+    m_async = new LoggerAsync(capacity, backPressure);
+    //fall back to printing if the file can't be created
+    m_async->binary = new BinaryLogWriter(binaryPath);
+    if (!m_async->binary->isOpen())
+    {
+        delete m_async->binary;
+        m_async->binary = nullptr;
+    }
+    m_async->writer = new Thread(LoggerAsync::writerMain, this);
+}
+
+s_Logger::s_Logger(bool _autoPrint, const FileSinkCreateInfo& sink)
+ : toPrint(1), toPrintIndex(sizeof(LogBatchEntry)), mutex("logger"), autoPrint(_autoPrint), print_func(logger_defaultPrint), batch_func(nullptr)
+{
+    m_fileSink = new FileSink(sink);
+}
+
+s_Logger::s_Logger(uint64_t capacity, LoggerBackPressure backPressure, const FileSinkCreateInfo& sink)
+ : toPrint(1), toPrintIndex(sizeof(LogBatchEntry)), mutex("logger"), autoPrint(false), print_func(logger_defaultPrint), batch_func(nullptr)
+{
+    //the sink must exist before the writer thread starts
+    m_fileSink = new FileSink(sink);
+    m_async = new LoggerAsync(capacity, backPressure);
+    m_async->writer = new Thread(LoggerAsync::writerMain, this);
+}
+
+s_Logger::s_Logger(const FlightRecorderCreateInfo& recorder)
+ : toPrint(1), toPrintIndex(sizeof(LogBatchEntry)), mutex("logger"), autoPrint(false), print_func(logger_defaultPrint), batch_func(nullptr)
+{
+    m_recorder = new FlightRecorder(recorder);
+}
+
+s_Logger::~s_Logger()
+{
+    delete m_recorder;
+    m_recorder = nullptr;
+    uint32_t sinkCount = m_sinkCount.load(std::memory_order_acquire);
+    //queued messages of a file logger or a logger with sinks are not lost
+    if (!m_async && (m_fileSink || sinkCount)) {printAll();}
+    if (m_async)
+    {
+        //let the writer print everything that is queued, then stop it
+        {
+            std::lock_guard<std::mutex> guard(m_async->mutex);
+            m_async->stop = true;
+            m_async->writerCond.notify_one();
+        }
+        delete m_async->writer;
+        delete m_async->binary;
+        delete m_async;
+    }
+    //the sinks write all batches they received before they stop
+    for (uint32_t i = 0; i < sinkCount; ++i) {delete m_sinks[i];}
+    delete m_fileSink;
+}
+
+uint64_t s_Logger::droppedCount() const noexcept {return m_async ? m_async->dropped.load(std::memory_order_relaxed) : 0;}
+
+s_LogSink* s_Logger::addSink(const LogSinkCreateInfo& info)
+{
+    //flight recorders and binary loggers never produce batches
+    if (m_recorder || (m_async && m_async->binary)) {return nullptr;}
+    std::lock_guard<std::mutex> guard(m_sinkMutex);
+    uint32_t count = m_sinkCount.load(std::memory_order_relaxed);
+    if (count >= GLGE_LOGGER_MAX_SINKS) {return nullptr;}
+    //publish the sink only after it is fully constructed
+    m_sinks[count] = new LogSink(info);
+    m_sinkCount.store(count + 1, std::memory_order_release);
+    return m_sinks[count];
+}
+
+void s_Logger::log(const char* string) {logText(string, strlen(string), GLGE_LOG_LEVEL_NONE);}
+
+void s_Logger::log(LogEvent& event)
+{
+    //the event is already encoded, so it is handed on like any other text
+    const char* text = logEvent_Finish(&event);
+    logText(text, event.size, event.level);
+}
+
+void s_Logger::logSuppressed(const LogCallSite* site, uint32_t count)
 {
+    //the summary has the level of the call site, so it passes the same sinks as the messages
+    char text[512];
+    int length = snprintf(text, sizeof(text), "%s%u messages suppressed (%s:%u)", logLevel_Prefix((LogLevel)site->level), count, site->file, site->line);
+    if (length < 0) {return;}
+    logText(text, ((size_t)length < sizeof(text)) ? (uint64_t)length : sizeof(text) - 1, (LogLevel)site->level);
+}
+
+void s_Logger::logText(const char* string, uint64_t length, LogLevel level)
+{
+    //flight recorders only store the message in memory. The text already carries the prefix it needs,
+    //structured events stay plain JSON lines.
+    if (m_recorder)
+    {
+        m_recorder->record(level, string, length, false);
+        return;
+    }
+
+    //asynchronous loggers only hand the message to the writer thread
+    if (m_async)
+    {
+        LogRecord record;
+        logRecord_SetText(string, length, level, &record);
+        record.timestamp = logRecord_Now();
+        m_async->push(record);
+        return;
+    }
+
     //check if direct logging is enabled
     //this switches between direct print and delayed printing
     if (autoPrint)
     {
         //create a temporary string
-        String str(string);
+        String str(string, length);
         //direct message logging
-        (*print_func)(&str);
+        if (!batch_func && !m_fileSink && (m_sinkCount.load(std::memory_order_acquire) == 0)) {(*print_func)(&str); return;}
+        LogBatchEntry entry{0, length, (uint32_t)level};
+        str += '\n';
+        printBatch({str.data(), str.size(), &entry, 1});
     }
     else
     {
         //lock the mutex. Important to be thread safe...
         mutex.lock();
-        //add the element
-        String* str = new String(string);
-        toPrint.push_back(&str);
+        //append the text and its position to the queued messages
+        LogBatchEntry entry{toPrint.byteSize, length, (uint32_t)level};
+        __loggerAppend(toPrint, string, length);
+        __loggerAppend(toPrint, "\n", 1);
+        toPrintIndex.push_back(&entry);
         //make sure to unlock the mutex
         mutex.unlock();
     }
 }
 
+void s_Logger::logDeferred(LogCallSite* site, const char* format, va_list args)
+{
+    //flight recorders format directly into the record
+    if (m_recorder)
+    {
+        m_recorder->recordFormatted((LogLevel)site->level, format, args);
+        return;
+    }
+
+    //synchronous loggers format the message directly
+    if (!m_async)
+    {
+        std::string str = logLevel_Prefix((LogLevel)site->level);
+        size_t start = str.size();
+        va_list copy;
+        va_copy(copy, args);
+        char local[256];
+        int length = vsnprintf(local, sizeof(local), format, copy);
+        va_end(copy);
+        if (length < 0) {return;}
+        if ((size_t)length < sizeof(local)) {str.append(local, (size_t)length);}
+        else
+        {
+            str.resize(start + (size_t)length);
+            vsnprintf(str.data() + start, (size_t)length + 1, format, args);
+        }
+        logText(str.data(), str.size(), (LogLevel)site->level);
+        return;
+    }
+
+    //the call site is registered on its first execution
+    uint32_t id = atomic32_Load(GLGE_ATOMIC_ACQUIRE, &site->id);
+    if (id == 0) {id = logCallSite_Register(site, format);}
+
+    //only copy the raw arguments
+    LogRecord record;
+    record.site = id;
+    record.flags = 0;
+    record.timestamp = logRecord_Now();
+    logRecord_Encode(site, args, &record);
+    m_async->push(record);
+}
+
+void s_Logger::setLevel(LogLevel level) noexcept
+{
+    //levels below the compile-time minimum can't be enabled, their calls don't exist
+    uint64_t minimum = ((uint32_t)level < GLGE_LOG_MIN_LEVEL) ? GLGE_LOG_MIN_LEVEL : (uint64_t)level;
+    uint64_t f = m_filter.load(std::memory_order_relaxed);
+    while (!m_filter.compare_exchange_weak(f, (minimum << 32) | (f & 0xFFFFFFFFull), std::memory_order_relaxed)) {}
+}
+
+void s_Logger::setCategoryEnabled(uint32_t category, bool enabled) noexcept
+{
+    uint64_t bit = 1ull << (category % GLGE_LOG_CATEGORY_COUNT);
+    if (enabled) {m_filter.fetch_or(bit, std::memory_order_relaxed);}
+    else {m_filter.fetch_and(~bit, std::memory_order_relaxed);}
+}
+
 void s_Logger::printAll()
 {
-    //speed check - if the print queue is empty, stop
-    if (toPrint.byteSize == 0) {return;}
-    //make sure to lock the mutex. No new stuff may be added while it is printing
-    mutex.lock();
-    //print all elements
-    uint64_t elCount = toPrint.byteSize/toPrint.elementSize;
-    for (uint64_t i = 0; i < elCount; ++i)
+    //flight recorders dump all recorded messages, but keep them
+    if (m_recorder)
     {
-        String* str = *((String**)toPrint[i]);
-        (*print_func)(str);
-        delete str;
+        std::cout.flush();
+        m_recorder->dump(1, UINT64_MAX);
+        return;
     }
-    //clear the whole vector
-    toPrint.clear();
-    //unlock the mutex
+
+    //asynchronous loggers wait till the writer printed everything that was logged till now
+    if (m_async)
+    {
+        uint64_t target = m_async->enqueued.load(std::memory_order_acquire);
+        std::unique_lock<std::mutex> lock(m_async->mutex);
+        while (m_async->printed.load(std::memory_order_acquire) < target)
+        {
+            m_async->writerCond.notify_one();
+            m_async->printedCond.wait(lock);
+        }
+        lock.unlock();
+        if (m_fileSink) {m_fileSink->flush();}
+        flushSinks();
+        return;
+    }
+
+    //take the queued messages while the mutex is locked, but print them without it, 
+    //so logging threads don't wait for the output. The drained buffers are emptied and
+    //swapped back in the next call, so their memory is reused.
+    std::lock_guard<std::mutex> drainGuard(m_drainMutex);
+    m_drainText.byteSize = 0;
+    m_drainIndex.byteSize = 0;
+    mutex.lock();
+    __loggerSwap(m_drainText, toPrint);
+    __loggerSwap(m_drainIndex, toPrintIndex);
     mutex.unlock();
+
+    //print all messages at once
+    uint64_t count = m_drainIndex.byteSize / sizeof(LogBatchEntry);
+    if (count != 0) {printBatch({(const char*)m_drainText.data(), m_drainText.byteSize, (const LogBatchEntry*)m_drainIndex.data(), count});}
+    if (m_fileSink) {m_fileSink->flush();}
+    flushSinks();
+}
+
+void s_Logger::flushSinks()
+{
+    uint32_t sinkCount = m_sinkCount.load(std::memory_order_acquire);
+    for (uint32_t i = 0; i < sinkCount; ++i) {m_sinks[i]->flush();}
+}
+
+void s_Logger::printBatch(const LogBatch& batch)
+{
+    //fan out to the sinks. The batch is copied once and shared by all sinks that receive a message of it.
+    uint32_t sinkCount = m_sinkCount.load(std::memory_order_acquire);
+    if (sinkCount)
+    {
+        uint32_t level = GLGE_LOG_LEVEL_NONE;
+        bool unleveled = false;
+        for (uint64_t i = 0; i < batch.count; ++i)
+        {
+            level = (batch.entries[i].level > level) ? batch.entries[i].level : level;
+            unleveled |= (batch.entries[i].level == GLGE_LOG_LEVEL_NONE);
+        }
+        uint32_t references = 0;
+        for (uint32_t i = 0; i < sinkCount; ++i) {references += (unleveled || m_sinks[i]->accepts(level)) ? 1 : 0;}
+        if (references == 0) {return;}
+        LogSharedBatch* shared = logSharedBatch_Create(batch, references);
+        for (uint32_t i = 0; i < sinkCount; ++i) {if (unleveled || m_sinks[i]->accepts(level)) {m_sinks[i]->push(shared);}}
+        return;
+    }
+
+    //a file sink takes the whole text at once, the highest level decides about an immediate write
+    if (m_fileSink)
+    {
+        uint32_t level = GLGE_LOG_LEVEL_NONE;
+        for (uint64_t i = 0; i < batch.count; ++i) {level = (batch.entries[i].level > level) ? batch.entries[i].level : level;}
+        m_fileSink->write(batch.text, batch.textSize, (LogLevel)level);
+        return;
+    }
+    if (batch_func) {(*batch_func)(&batch); return;}
+
+    //the default print function writes and flushes the whole batch at once
+    if (print_func == logger_defaultPrint)
+    {
+        std::cout.write(batch.text, (std::streamsize)batch.textSize);
+        std::cout.flush();
+        return;
+    }
+
+    //the string is re-used for all lines
+    String line;
+    for (uint64_t i = 0; i < batch.count; ++i)
+    {
+        line.assign(batch.text + batch.entries[i].offset, batch.entries[i].length);
+        (*print_func)(&line);
+    }
 }
 
 
@@ -73,10 +657,56 @@ Logger* logger_CreateAutoPrint(bool autoPrint) {return new Logger(autoPrint);}
 
 Logger* logger_CreateAndOverload(bool autoPrint, void (*func)(String*)) {return new Logger(autoPrint, func);}
 
+Logger* logger_CreateWithFileSink(bool autoPrint, const FileSinkCreateInfo* sink) {return new Logger(autoPrint, *sink);}
+
+Logger* logger_CreateFlightRecorder(const FlightRecorderCreateInfo* recorder) {return new Logger(*recorder);}
+
+FlightRecorder* logger_GetFlightRecorder(const Logger* logger) {return logger->flightRecorder();}
+
+Logger* logger_CreateAsync(uint64_t capacity, LoggerBackPressure backPressure, void (*func)(String*)) {return new Logger(capacity, backPressure, func);}
+
+Logger* logger_CreateBinary(const char* path, uint64_t capacity, LoggerBackPressure backPressure) {return new Logger(path, capacity, backPressure);}
+
+Logger* logger_CreateAsyncWithFileSink(uint64_t capacity, LoggerBackPressure backPressure, const FileSinkCreateInfo* sink) {return new Logger(capacity, backPressure, *sink);}
+
 void logger_Destroy(Logger* logger) {delete logger;}
 
 void logger_log(const char* cstr, Logger* logger) {logger->log(cstr);}
 
 void logger_logString(const String* str, Logger* logger) {logger->log(*str);}
 
+void logger_logDeferred(LogCallSite* site, Logger* logger, const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    logger->logDeferred(site, format, args);
+    va_end(args);
+}
+
+void logger_logEvent(LogEvent* event, Logger* logger) {logger->log(*event);}
+
+void logger_logSuppressed(uint32_t count, const LogCallSite* site, Logger* logger) {logger->logSuppressed(site, count);}
+
+LogSink* logger_AddSink(const LogSinkCreateInfo* info, Logger* logger) {return logger->addSink(*info);}
+
 void logger_printAll(Logger* logger) {logger->printAll();}
+
+bool logger_IsAsync(const Logger* logger) {return logger->isAsync();}
+
+uint64_t logger_DroppedCount(const Logger* logger) {return logger->droppedCount();}
+
+void logger_SetLevel(LogLevel level, Logger* logger) {logger->setLevel(level);}
+
+LogLevel logger_GetLevel(const Logger* logger) {return logger->level();}
+
+void logger_SetCategoryEnabled(uint32_t category, bool enabled, Logger* logger) {logger->setCategoryEnabled(category, enabled);}
+
+bool logger_IsEnabled(LogLevel level, uint32_t category, const Logger* logger) {return logger->isEnabled(level, category);}
+
+void logger_SetBatchFunction(void (*func)(const LogBatch* batch), Logger* logger) {logger->setBatchFunction(func);}
+
+const char* logBatch_Get(uint64_t index, uint64_t* length, const LogBatch* batch)
+{
+    *length = batch->entries[index].length;
+    return batch->text + batch->entries[index].offset;
+}
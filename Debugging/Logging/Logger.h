@@ -21,6 +21,32 @@
 //or for one thread to print the log while another writes to it
 #include "../../CBinding/Mutex.h"
 
+//messages can be logged without formatting them on the logging thread
+#include "BinaryLog.h"
+//messages have a level and a category
+#include "LogLevel.h"
+//loggers can write to a buffered file
+#include "FileSink.h"
+//loggers can keep the recent messages in memory
+#include "FlightRecorder.h"
+//messages can carry typed key-value fields
+#include "StructuredLog.h"
+//call sites can be rate limited and sampled
+#include "LogLimiter.h"
+//loggers can fan out to multiple sinks
+#include "LogSink.h"
+
+//the filter of the logger is checked without locking
+#if __cplusplus
+#include <atomic>
+#include <mutex>
+#endif
+
+/**
+ * @brief the filter new loggers start with: the compile-time minimum level and all categories enabled
+ */
+#define GLGE_LOGGER_DEFAULT_FILTER ((((uint64_t)GLGE_LOG_MIN_LEVEL) << 32) | 0xFFFFFFFFull)
+
 //start an extern section for C
 //just to be sure
 #if __cplusplus
@@ -39,6 +65,11 @@ void logger_defaultPrint(String* str);
 }
 #endif
 
+//the state of asynchronous loggers is only known to the implementation
+#if __cplusplus
+struct LoggerAsync;
+#endif
+
 /**
  * @brief store the actual logger
  * 
@@ -46,8 +77,10 @@ void logger_defaultPrint(String* str);
  */
 typedef struct s_Logger {
 
-    //store a vector of string pointer that can be printed
+    //store the text of all messages that can be printed, each followed by a new line
     Vector toPrint;
+    //store a LogBatchEntry per message that can be printed
+    Vector toPrintIndex;
     //store the mutex to sync thread access
     Mutex mutex;
     //a boolean to say if the logger should auto-call the print function if an element is added
@@ -55,6 +88,8 @@ typedef struct s_Logger {
 
     //a function that is used to print all lines of the log to some place
     void (*print_func)(String* str);
+    //an optional function that prints whole batches of lines. If set, it is used instead of the print function.
+    void (*batch_func)(const LogBatch* batch);
 
     //implement a C++ interface
     #if __cplusplus
@@ -66,13 +101,62 @@ typedef struct s_Logger {
      * @param func a function pointer to the function to use for printing
      */
     s_Logger(bool _autoPrint = false, void (*func)(String*) = logger_defaultPrint)
-     : toPrint(sizeof(String*)), mutex(), autoPrint(_autoPrint), print_func(func)
+     : toPrint(1), toPrintIndex(sizeof(LogBatchEntry)), mutex("logger"), autoPrint(_autoPrint), print_func(func), batch_func(nullptr)
     {}
 
     /**
-     * @brief Destroy the Logger
+     * @brief Construct a new asynchronous Logger
+     * 
+     * Logging only adds the message to a lock-free queue. A dedicated writer thread prints the messages in batches.
+     * 
+     * @param capacity the minimum amount of messages the queue can hold
+     * @param backPressure what to do if the queue is full
+     * @param func a function pointer to the function to use for printing. It is only called from the writer thread.
+     */
+    s_Logger(uint64_t capacity, LoggerBackPressure backPressure, void (*func)(String*) = logger_defaultPrint);
+
+    /**
+     * @brief Construct a new asynchronous Logger that writes a binary log file
+     * 
+     * Deferred messages are written unformatted and can be turned into text using binaryLog_Decode. If the file can't be
+     * created, the messages are formatted and printed using the default print function instead.
+     * 
+     * @param binaryPath the path of the binary log file to create
+     * @param capacity the minimum amount of messages the queue can hold
+     * @param backPressure what to do if the queue is full
+     */
+    s_Logger(const char* binaryPath, uint64_t capacity, LoggerBackPressure backPressure);
+
+    /**
+     * @brief Construct a new Logger that writes to a buffered file
+     * 
+     * @param _autoPrint true : all log events are handed to the file instantly | false : logging events are queued up till printAll is called
+     * @param sink the options of the file
+     */
+    s_Logger(bool _autoPrint, const FileSinkCreateInfo& sink);
+
+    /**
+     * @brief Construct a new asynchronous Logger that writes to a buffered file
+     * 
+     * @param capacity the minimum amount of messages the queue can hold
+     * @param backPressure what to do if the queue is full
+     * @param sink the options of the file
+     */
+    s_Logger(uint64_t capacity, LoggerBackPressure backPressure, const FileSinkCreateInfo& sink);
+
+    /**
+     * @brief Construct a new Logger that only keeps the most recent messages in a flight recorder
+     * 
+     * Logging never performs I/O. printAll dumps the recorded messages to the standard output.
+     * 
+     * @param recorder the options of the flight recorder
      */
-    ~s_Logger() {}
+    s_Logger(const FlightRecorderCreateInfo& recorder);
+
+    /**
+     * @brief Destroy the Logger. An asynchronous logger prints all queued messages first.
+     */
+    ~s_Logger();
 
     /**
      * @brief log a single constant string
@@ -88,11 +172,182 @@ typedef struct s_Logger {
      */
     inline void log(const String& string) {log(string.c_str());}
 
+    /**
+     * @brief log a printf style message. Asynchronous loggers only record the arguments and format them on the writer thread.
+     * 
+     * @param site the call site of the message
+     * @param format the format string. Must be the same for every call of the call site.
+     * @param args the arguments for the format string
+     */
+    void logDeferred(LogCallSite* site, const char* format, va_list args);
+
+    /**
+     * @brief log a structured event as a single JSON line. Check GLGE_LOG_ENABLED before building the event to skip the encoding.
+     * 
+     * @param event the event to log. It is finished, so no fields can be added afterwards.
+     */
+    void log(LogEvent& event);
+
+    /**
+     * @brief log that a rate limited call site dropped messages
+     * 
+     * @param site the call site that dropped the messages
+     * @param count the amount of dropped messages
+     */
+    void logSuppressed(const LogCallSite* site, uint32_t count);
+
+    /**
+     * @brief check if messages of a level and category are logged
+     * 
+     * @param level the level of the message
+     * @param category the category of the message
+     * @return true : the message is logged
+     * @return false : the message is filtered out
+     */
+    inline bool isEnabled(LogLevel level, uint32_t category) const noexcept
+    {
+        uint64_t f = m_filter.load(std::memory_order_relaxed);
+        return ((uint32_t)level >= (uint32_t)(f >> 32)) && ((f >> (category % GLGE_LOG_CATEGORY_COUNT)) & 1);
+    }
+
+    /**
+     * @brief set the minimum level of logged messages. Levels below the compile-time minimum stay disabled.
+     * 
+     * @param level the new minimum level
+     */
+    void setLevel(LogLevel level) noexcept;
+
+    /**
+     * @brief get the minimum level of logged messages
+     * 
+     * @return LogLevel the minimum level
+     */
+    inline LogLevel level() const noexcept {return (LogLevel)(m_filter.load(std::memory_order_relaxed) >> 32);}
+
+    /**
+     * @brief enable or disable the messages of a category
+     * 
+     * @param category the category to change
+     * @param enabled true to log the messages of the category, false to filter them out
+     */
+    void setCategoryEnabled(uint32_t category, bool enabled) noexcept;
+
     /**
      * @brief print and clear all data logged in the logger
+     * 
+     * For an asynchronous logger this is a flush barrier: it returns once all messages logged before the call are printed.
+     * The buffer of a file sink is written to the file.
      */
     void printAll();
 
+    /**
+     * @brief get the flight recorder of the logger, e.g. to dump it or install a crash handler
+     * 
+     * @return s_FlightRecorder* a pointer to the flight recorder or NULL if the logger does not record
+     */
+    inline s_FlightRecorder* flightRecorder() const noexcept {return m_recorder;}
+
+    /**
+     * @brief set a function that prints whole batches of lines instead of single lines
+     * 
+     * @param func the function to print batches with or NULL to use the print function again. Set it before logging.
+     */
+    inline void setBatchFunction(void (*func)(const LogBatch*)) noexcept {batch_func = func;}
+
+    /**
+     * @brief check if the logger prints on a writer thread
+     * 
+     * @return true : the logger is asynchronous
+     * @return false : the logger prints on the calling thread
+     */
+    inline bool isAsync() const noexcept {return m_async != nullptr;}
+
+    /**
+     * @brief get the amount of messages that were dropped because the queue was full
+     * 
+     * @return uint64_t the amount of dropped messages
+     */
+    uint64_t droppedCount() const noexcept;
+
+    /**
+     * @brief add a sink to the logger. Once a sink is added, all batches go to the sinks instead of the print functions.
+     * 
+     * The sink is owned by the logger and destroyed with it.
+     * 
+     * @param info the options of the sink
+     * @return s_LogSink* a pointer to the new sink or NULL if the logger has GLGE_LOGGER_MAX_SINKS sinks already or is a
+     * flight recorder or binary logger. Those never produce batches, so they can't feed sinks.
+     */
+    s_LogSink* addSink(const LogSinkCreateInfo& info);
+
+protected:
+
+    /**
+     * @brief hand a batch of lines to the batch function or the print function
+     * 
+     * @param batch the batch to print
+     */
+    void printBatch(const LogBatch& batch);
+
+    /**
+     * @brief wait till all sinks wrote the batches they received, then flush them
+     */
+    void flushSinks();
+
+    /**
+     * @brief log a message with a known length and level
+     * 
+     * @param string the message
+     * @param length the length of the message in bytes
+     * @param level the level of the message
+     */
+    void logText(const char* string, uint64_t length, LogLevel level);
+
+    //the writer thread of asynchronous loggers accesses the state
+    friend struct LoggerAsync;
+
+    /**
+     * @brief the state of an asynchronous logger or NULL for a synchronous logger
+     */
+    LoggerAsync* m_async = nullptr;
+    /**
+     * @brief the buffers printAll swaps with the queued messages. Kept to reuse their memory.
+     */
+    Vector m_drainText{1};
+    /**
+     * @brief the index that belongs to the drain text
+     */
+    Vector m_drainIndex{sizeof(LogBatchEntry)};
+    /**
+     * @brief serializes printAll calls, so the drain buffers are only used by one thread
+     */
+    std::mutex m_drainMutex;
+    /**
+     * @brief the file the messages are written to or NULL to use the print functions
+     */
+    FileSink* m_fileSink = nullptr;
+    /**
+     * @brief the flight recorder the messages are stored in or NULL
+     */
+    FlightRecorder* m_recorder = nullptr;
+    /**
+     * @brief the sinks of the logger. Only the first m_sinkCount elements are used, they never change once set.
+     */
+    LogSink* m_sinks[GLGE_LOGGER_MAX_SINKS] = {};
+    /**
+     * @brief the amount of sinks
+     */
+    std::atomic<uint32_t> m_sinkCount{0};
+    /**
+     * @brief serializes adding sinks
+     */
+    std::mutex m_sinkMutex;
+    /**
+     * @brief the minimum level in the upper 32 bits and a bit per enabled category in the lower 32 bits. Packed together,
+     * so checking if a message is logged is a single relaxed load.
+     */
+    std::atomic<uint64_t> m_filter{GLGE_LOGGER_DEFAULT_FILTER};
+
     #endif
 
 } Logger;
@@ -127,6 +382,61 @@ Logger* logger_CreateAutoPrint(bool autoPrint);
  */
 Logger* logger_CreateAndOverload(bool autoPrint, void (*func)(String*));
 
+/**
+ * @brief construct a new logger that writes to a buffered file
+ * 
+ * @param autoPrint true : all log events are handed to the file instantly | false : logging events are queued up till logger_printAll is called
+ * @param sink the options of the file
+ * @return Logger* the new logger
+ */
+Logger* logger_CreateWithFileSink(bool autoPrint, const FileSinkCreateInfo* sink);
+
+/**
+ * @brief construct a new logger that only keeps the most recent messages in a flight recorder
+ * 
+ * @param recorder the options of the flight recorder
+ * @return Logger* the new logger
+ */
+Logger* logger_CreateFlightRecorder(const FlightRecorderCreateInfo* recorder);
+
+/**
+ * @brief get the flight recorder of a logger
+ * 
+ * @param logger the logger to quarry
+ * @return FlightRecorder* a pointer to the flight recorder or NULL if the logger does not record
+ */
+FlightRecorder* logger_GetFlightRecorder(const Logger* logger);
+
+/**
+ * @brief construct a new asynchronous logger. Messages are queued and printed in batches by a dedicated writer thread.
+ * 
+ * @param capacity the minimum amount of messages the queue can hold
+ * @param backPressure what to do if the queue is full
+ * @param func a function pointer to the function to use for printing or NULL for the default print function
+ * @return Logger* the new logger
+ */
+Logger* logger_CreateAsync(uint64_t capacity, LoggerBackPressure backPressure, void (*func)(String*));
+
+/**
+ * @brief construct a new asynchronous logger that writes deferred messages unformatted to a binary log file
+ * 
+ * @param path the path of the binary log file to create
+ * @param capacity the minimum amount of messages the queue can hold
+ * @param backPressure what to do if the queue is full
+ * @return Logger* the new logger
+ */
+Logger* logger_CreateBinary(const char* path, uint64_t capacity, LoggerBackPressure backPressure);
+
+/**
+ * @brief construct a new asynchronous logger whose writer thread writes to a buffered file
+ * 
+ * @param capacity the minimum amount of messages the queue can hold
+ * @param backPressure what to do if the queue is full
+ * @param sink the options of the file
+ * @return Logger* the new logger
+ */
+Logger* logger_CreateAsyncWithFileSink(uint64_t capacity, LoggerBackPressure backPressure, const FileSinkCreateInfo* sink);
+
 /**
  * @brief destroy a logger object
  * 
@@ -151,15 +461,250 @@ void logger_log(const char* cstr, Logger* logger);
 void logger_logString(const String* str, Logger* logger);
 
 /**
- * @brief print all the log data
+ * @brief log a printf style message. Use GLGE_LOG_DEFERRED instead of calling this directly.
+ * 
+ * @param site the call site of the message
+ * @param logger the logger to log to
+ * @param format the format string. Must be the same for every call of the call site.
+ * @param ... the arguments for the format string
+ */
+void logger_logDeferred(LogCallSite* site, Logger* logger, const char* format, ...);
+
+/**
+ * @brief log a structured event as a single JSON line. Check GLGE_LOG_ENABLED before building the event to skip the encoding.
+ * 
+ * @param event the event to log. It is finished, so no fields can be added afterwards.
+ * @param logger the logger to log to
+ */
+void logger_logEvent(LogEvent* event, Logger* logger);
+
+/**
+ * @brief log that a rate limited call site dropped messages. Used by GLGE_LOG_LIMITED.
+ * 
+ * @param count the amount of dropped messages
+ * @param site the call site that dropped the messages
+ * @param logger the logger to log to
+ */
+void logger_logSuppressed(uint32_t count, const LogCallSite* site, Logger* logger);
+
+/**
+ * @brief set the minimum level of the messages a logger logs
+ * 
+ * @param level the new minimum level
+ * @param logger the logger to change
+ */
+void logger_SetLevel(LogLevel level, Logger* logger);
+
+/**
+ * @brief get the minimum level of the messages a logger logs
+ * 
+ * @param logger the logger to quarry
+ * @return LogLevel the minimum level
+ */
+LogLevel logger_GetLevel(const Logger* logger);
+
+/**
+ * @brief enable or disable the messages of a category for a logger
+ * 
+ * @param category the category to change, from 0 to GLGE_LOG_CATEGORY_COUNT-1
+ * @param enabled true to log the messages of the category, false to filter them out
+ * @param logger the logger to change
+ */
+void logger_SetCategoryEnabled(uint32_t category, bool enabled, Logger* logger);
+
+/**
+ * @brief check if a logger logs messages of a level and category
+ * 
+ * @param level the level of the message
+ * @param category the category of the message
+ * @param logger the logger to check
+ * @return true : the message is logged
+ * @return false : the message is filtered out
+ */
+bool logger_IsEnabled(LogLevel level, uint32_t category, const Logger* logger);
+
+/**
+ * @brief set a function that prints whole batches of lines instead of single lines
+ * 
+ * @param func the function to print batches with or NULL to use the print function again. Set it before logging.
+ * @param logger the logger to change
+ */
+void logger_SetBatchFunction(void (*func)(const LogBatch* batch), Logger* logger);
+
+/**
+ * @brief add a sink to a logger. Once a sink is added, all batches go to the sinks instead of the print functions.
+ * 
+ * @param info the options of the sink
+ * @param logger the logger to add the sink to. It owns the sink.
+ * @return LogSink* a pointer to the new sink or NULL if the logger has GLGE_LOGGER_MAX_SINKS sinks already or is a flight
+ * recorder or binary logger. Those never produce batches, so they can't feed sinks.
+ */
+LogSink* logger_AddSink(const LogSinkCreateInfo* info, Logger* logger);
+
+/**
+ * @brief get a single message of a log batch
+ * 
+ * @param index the index of the message
+ * @param length filled with the length of the message in bytes
+ * @param batch the batch to quarry
+ * @return const char* a pointer to the first character of the message. Not null terminated.
+ */
+const char* logBatch_Get(uint64_t index, uint64_t* length, const LogBatch* batch);
+
+/**
+ * @brief print all the log data. For an asynchronous logger, this waits till all messages logged before are printed.
  * 
  * @param logger the logger to print from
  */
 void logger_printAll(Logger* logger);
 
+/**
+ * @brief check if a logger prints on a writer thread
+ * 
+ * @param logger the logger to quarry
+ * @return true : the logger is asynchronous
+ * @return false : the logger prints on the calling thread
+ */
+bool logger_IsAsync(const Logger* logger);
+
+/**
+ * @brief get the amount of messages that were dropped because the queue of an asynchronous logger was full
+ * 
+ * @param logger the logger to quarry
+ * @return uint64_t the amount of dropped messages
+ */
+uint64_t logger_DroppedCount(const Logger* logger);
+
 //the the extern section in C++
 #if __cplusplus
 }
 #endif
 
+/**
+ * @brief check if a logger logs messages of a level and category. C++ checks inline, C calls logger_IsEnabled.
+ * 
+ * @param level the level of the message
+ * @param category the category of the message
+ * @param logger a pointer to the logger to check
+ */
+#if __cplusplus
+#define GLGE_LOG_ENABLED(level, category, logger) ((logger)->isEnabled((level), (category)))
+#else
+#define GLGE_LOG_ENABLED(level, category, logger) logger_IsEnabled((level), (category), (logger))
+#endif
+
+/**
+ * @brief log a printf style message with a level and category. The arguments are only evaluated if the logger logs the message.
+ * 
+ * @param logger a pointer to the logger to log to
+ * @param level the level of the message. Must be a constant.
+ * @param category the category of the message
+ * @param ... the format string followed by its arguments
+ */
+#define GLGE_LOG_AT(logger, level, category, ...) do { \
+    if (GLGE_LOG_ENABLED((level), (category), (logger))) { \
+        static LogCallSite __glgeLogCallSite = GLGE_LOG_CALL_SITE_INIT(level); \
+        logger_logDeferred(&__glgeLogCallSite, (logger), __VA_ARGS__); \
+    } \
+} while (0)
+
+/**
+ * @brief log a printf style message of a level and category through a limiter. The limiter is created once per call site.
+ * 
+ * Dropped messages only cost the filter check and the limiter check, the arguments are not evaluated. The amount of
+ * messages the rate limit dropped is logged right before the next message that passes.
+ * 
+ * @param logger a pointer to the logger to log to
+ * @param level the level of the message
+ * @param category the category of the message
+ * @param limiterInit the initial state of the limiter, created with GLGE_LOG_LIMITER_INIT
+ * @param ... the printf style format string and its arguments
+ */
+#define GLGE_LOG_LIMITED_WITH(logger, level, category, limiterInit, ...) do { \
+    if (GLGE_LOG_ENABLED((level), (category), (logger))) { \
+        static LogCallSite __glgeLogCallSite = GLGE_LOG_CALL_SITE_INIT(level); \
+        static LogLimiter __glgeLogLimiter = limiterInit; \
+        uint32_t __glgeSuppressed; \
+        if (logLimiter_Allow(&__glgeSuppressed, &__glgeLogLimiter)) { \
+            if (__glgeSuppressed) {logger_logSuppressed(__glgeSuppressed, &__glgeLogCallSite, (logger));} \
+            logger_logDeferred(&__glgeLogCallSite, (logger), __VA_ARGS__); \
+        } \
+    } \
+} while (0)
+
+/**
+ * @brief log a printf style message, but at most perSecond messages per second on average from this call site
+ * 
+ * @param logger a pointer to the logger to log to
+ * @param level the level of the message
+ * @param category the category of the message
+ * @param perSecond the average amount of messages per second
+ * @param burst the amount of messages that can pass at once after a quiet period
+ * @param ... the printf style format string and its arguments
+ */
+#define GLGE_LOG_LIMITED(logger, level, category, perSecond, burst, ...) \
+    GLGE_LOG_LIMITED_WITH(logger, level, category, GLGE_LOG_LIMITER_INIT(perSecond, burst, 0, false), __VA_ARGS__)
+
+/**
+ * @brief log only every n-th printf style message of this call site
+ * 
+ * @param logger a pointer to the logger to log to
+ * @param level the level of the message
+ * @param category the category of the message
+ * @param every only one of this many messages is logged
+ * @param ... the printf style format string and its arguments
+ */
+#define GLGE_LOG_SAMPLED(logger, level, category, every, ...) \
+    GLGE_LOG_LIMITED_WITH(logger, level, category, GLGE_LOG_LIMITER_INIT(0, 0, every, false), __VA_ARGS__)
+
+/**
+ * @brief log each printf style message of this call site with a chance of 1 / every
+ * 
+ * @param logger a pointer to the logger to log to
+ * @param level the level of the message
+ * @param category the category of the message
+ * @param every on average, one of this many messages is logged
+ * @param ... the printf style format string and its arguments
+ */
+#define GLGE_LOG_SAMPLED_RANDOM(logger, level, category, every, ...) \
+    GLGE_LOG_LIMITED_WITH(logger, level, category, GLGE_LOG_LIMITER_INIT(0, 0, every, true), __VA_ARGS__)
+
+//the level macros expand to nothing if their level is below the compile-time minimum
+
+#if GLGE_LOG_MIN_LEVEL <= 1
+#define GLGE_LOG_TRACE(logger, category, ...) GLGE_LOG_AT(logger, GLGE_LOG_LEVEL_TRACE, category, __VA_ARGS__)
+#else
+#define GLGE_LOG_TRACE(logger, category, ...) ((void)0)
+#endif
+
+#if GLGE_LOG_MIN_LEVEL <= 2
+#define GLGE_LOG_DEBUG(logger, category, ...) GLGE_LOG_AT(logger, GLGE_LOG_LEVEL_DEBUG, category, __VA_ARGS__)
+#else
+#define GLGE_LOG_DEBUG(logger, category, ...) ((void)0)
+#endif
+
+#if GLGE_LOG_MIN_LEVEL <= 3
+#define GLGE_LOG_INFO(logger, category, ...) GLGE_LOG_AT(logger, GLGE_LOG_LEVEL_INFO, category, __VA_ARGS__)
+#else
+#define GLGE_LOG_INFO(logger, category, ...) ((void)0)
+#endif
+
+#if GLGE_LOG_MIN_LEVEL <= 4
+#define GLGE_LOG_WARNING(logger, category, ...) GLGE_LOG_AT(logger, GLGE_LOG_LEVEL_WARNING, category, __VA_ARGS__)
+#else
+#define GLGE_LOG_WARNING(logger, category, ...) ((void)0)
+#endif
+
+#if GLGE_LOG_MIN_LEVEL <= 5
+#define GLGE_LOG_ERROR(logger, category, ...) GLGE_LOG_AT(logger, GLGE_LOG_LEVEL_ERROR, category, __VA_ARGS__)
+#else
+#define GLGE_LOG_ERROR(logger, category, ...) ((void)0)
+#endif
+
+#if GLGE_LOG_MIN_LEVEL <= 6
+#define GLGE_LOG_FATAL(logger, category, ...) GLGE_LOG_AT(logger, GLGE_LOG_LEVEL_FATAL, category, __VA_ARGS__)
+#else
+#define GLGE_LOG_FATAL(logger, category, ...) ((void)0)
+#endif
+
 #endif
\ No newline at end of file
@@ -15,5 +15,21 @@
 
 //include the semi-abstract logger class
 #include "Logger.h"
+//include log levels and categories
+#include "LogLevel.h"
+//include deferred log records and binary log files
+#include "BinaryLog.h"
+//include buffered log files
+#include "FileSink.h"
+//include the in-memory flight recorder
+#include "FlightRecorder.h"
+//include structured key-value events
+#include "StructuredLog.h"
+//include rate limiting and sampling of call sites
+#include "LogLimiter.h"
+//include the sinks a logger can fan out to
+#include "LogSink.h"
+//include the compression of log files
+#include "LogCompression.h"
 
 #endif
\ No newline at end of file
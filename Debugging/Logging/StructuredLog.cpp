@@ -0,0 +1,237 @@
+/**
+ * @file StructuredLog.cpp
+ * @author DM8AT
+ * @brief implement the encoding of structured log events
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include structured logging
+#include "StructuredLog.h"
+
+//memory management stuff
+#include <cstring>
+#include <cmath>
+#include <charconv>
+#include <chrono>
+
+/**
+ * @brief the bytes kept free at the end of the buffer for the closing of the event: ,"truncated":true}
+ */
+#define GLGE_LOG_EVENT_RESERVE 20
+
+/**
+ * @brief get the name of a level as used in events
+ * 
+ * @param level the level
+ * @return const char* the name of the level
+ */
+static const char* __logEventLevelName(LogLevel level)
+{
+    switch (level)
+    {
+    case GLGE_LOG_LEVEL_TRACE: return "TRACE";
+    case GLGE_LOG_LEVEL_DEBUG: return "DEBUG";
+    case GLGE_LOG_LEVEL_INFO: return "INFO";
+    case GLGE_LOG_LEVEL_WARNING: return "WARNING";
+    case GLGE_LOG_LEVEL_ERROR: return "ERROR";
+    case GLGE_LOG_LEVEL_FATAL: return "FATAL";
+    default: return "NONE";
+    }
+}
+
+/**
+ * @brief write a string as quoted JSON string
+ * 
+ * @param out the position to write to
+ * @param end the end of the usable memory
+ * @param str the string to write
+ * @return char* the position after the string or NULL if it did not fit
+ */
+static char* __logEventString(char* out, char* end, const char* str)
+{
+    static const char hex[] = "0123456789abcdef";
+    if (out >= end) {return nullptr;}
+    *out++ = '"';
+    for (const unsigned char* c = (const unsigned char*)str; *c; ++c)
+    {
+        //the longest escape sequence has 6 characters
+        if (end - out < 6) {return nullptr;}
+        switch (*c)
+        {
+        case '"': *out++ = '\\'; *out++ = '"'; break;
+        case '\\': *out++ = '\\'; *out++ = '\\'; break;
+        case '\n': *out++ = '\\'; *out++ = 'n'; break;
+        case '\r': *out++ = '\\'; *out++ = 'r'; break;
+        case '\t': *out++ = '\\'; *out++ = 't'; break;
+        default:
+            if (*c < 0x20)
+            {
+                memcpy(out, "\\u00", 4);
+                out[4] = hex[*c >> 4];
+                out[5] = hex[*c & 0xF];
+                out += 6;
+            }
+            else {*out++ = (char)*c;}
+            break;
+        }
+    }
+    if (out >= end) {return nullptr;}
+    *out++ = '"';
+    return out;
+}
+
+/**
+ * @brief start a new field: the separator and the key
+ * 
+ * @param key the name of the field
+ * @param event the event to add the field to
+ * @param end filled with the end of the usable memory
+ * @return char* the position to write the value to or NULL if the field can't be added
+ */
+static char* __logEventKey(const char* key, LogEvent* event, char*& end)
+{
+    if (event->finished) {return nullptr;}
+    end = event->buffer + GLGE_LOG_EVENT_CAPACITY - GLGE_LOG_EVENT_RESERVE;
+    char* out = event->buffer + event->size;
+    if (out >= end) {return nullptr;}
+    *out++ = ',';
+    out = __logEventString(out, end, key ? key : "");
+    if (!out || (out >= end)) {return nullptr;}
+    *out++ = ':';
+    return out;
+}
+
+/**
+ * @brief complete a field
+ * 
+ * @param out the position after the value or NULL if the value did not fit
+ * @param event the event the field was added to
+ */
+static void __logEventCommit(char* out, LogEvent* event)
+{
+    //a field that did not fit is dropped completely
+    if (!out) {event->truncated = true; return;}
+    event->size = (uint32_t)(out - event->buffer);
+}
+
+extern "C" {
+
+void logEvent_Begin(LogLevel level, const char* message, LogEvent* event)
+{
+    event->level = level;
+    event->truncated = false;
+    event->finished = false;
+
+    //the fixed part of the event: timestamp, level and message
+    char* out = event->buffer;
+    char* end = event->buffer + GLGE_LOG_EVENT_CAPACITY - GLGE_LOG_EVENT_RESERVE;
+    memcpy(out, "{\"ts\":", 6);
+    out += 6;
+    uint64_t now = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    out = std::to_chars(out, end, now).ptr;
+    const char* levelName = __logEventLevelName(level);
+    memcpy(out, ",\"level\":\"", 10);
+    out += 10;
+    size_t levelLength = strlen(levelName);
+    memcpy(out, levelName, levelLength);
+    out += levelLength;
+    memcpy(out, "\",\"msg\":", 8);
+    out += 8;
+    event->size = (uint32_t)(out - event->buffer);
+
+    //a message that is too long is dropped, so the event stays valid JSON
+    char* msg = __logEventString(out, end, message ? message : "");
+    if (!msg) {msg = __logEventString(out, end, ""); event->truncated = true;}
+    event->size = (uint32_t)(msg - event->buffer);
+}
+
+void logEvent_AddInt(const char* key, int64_t value, LogEvent* event)
+{
+    char* end;
+    char* out = __logEventKey(key, event, end);
+    if (out)
+    {
+        std::to_chars_result result = std::to_chars(out, end, value);
+        out = (result.ec == std::errc()) ? result.ptr : nullptr;
+    }
+    __logEventCommit(out, event);
+}
+
+void logEvent_AddUInt(const char* key, uint64_t value, LogEvent* event)
+{
+    char* end;
+    char* out = __logEventKey(key, event, end);
+    if (out)
+    {
+        std::to_chars_result result = std::to_chars(out, end, value);
+        out = (result.ec == std::errc()) ? result.ptr : nullptr;
+    }
+    __logEventCommit(out, event);
+}
+
+void logEvent_AddFloat(const char* key, double value, LogEvent* event)
+{
+    char* end;
+    char* out = __logEventKey(key, event, end);
+    if (out)
+    {
+        //JSON has no representation for infinity and NaN
+        if (!std::isfinite(value))
+        {
+            if (end - out >= 4) {memcpy(out, "null", 4); out += 4;}
+            else {out = nullptr;}
+        }
+        else
+        {
+            //the shortest representation that reads back to the same value
+            std::to_chars_result result = std::to_chars(out, end, value);
+            out = (result.ec == std::errc()) ? result.ptr : nullptr;
+        }
+    }
+    __logEventCommit(out, event);
+}
+
+void logEvent_AddString(const char* key, const char* value, LogEvent* event)
+{
+    char* end;
+    char* out = __logEventKey(key, event, end);
+    if (out)
+    {
+        if (value) {out = __logEventString(out, end, value);}
+        else if (end - out >= 4) {memcpy(out, "null", 4); out += 4;}
+        else {out = nullptr;}
+    }
+    __logEventCommit(out, event);
+}
+
+void logEvent_AddBool(const char* key, bool value, LogEvent* event)
+{
+    char* end;
+    char* out = __logEventKey(key, event, end);
+    if (out)
+    {
+        const char* text = value ? "true" : "false";
+        size_t length = value ? 4 : 5;
+        if ((size_t)(end - out) >= length) {memcpy(out, text, length); out += length;}
+        else {out = nullptr;}
+    }
+    __logEventCommit(out, event);
+}
+
+const char* logEvent_Finish(LogEvent* event)
+{
+    if (event->finished) {return event->buffer;}
+    //the reserved space always fits the closing
+    char* out = event->buffer + event->size;
+    if (event->truncated) {memcpy(out, ",\"truncated\":true", 17); out += 17;}
+    *out++ = '}';
+    event->size = (uint32_t)(out - event->buffer);
+    event->finished = true;
+    return event->buffer;
+}
+
+}
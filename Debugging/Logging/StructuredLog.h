@@ -0,0 +1,217 @@
+/**
+ * @file StructuredLog.h
+ * @author DM8AT
+ * @brief define structured log events made of a message and typed fields, encoded as JSON lines
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_BG_STRUCTURED_LOG_
+#define _GLGE_BG_STRUCTURED_LOG_
+
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+//events have a level
+#include "LogLevel.h"
+
+/**
+ * @brief the maximum size of an encoded log event in bytes. Fields that don't fit anymore are dropped.
+ */
+#define GLGE_LOG_EVENT_CAPACITY 1024
+
+/**
+ * @brief store a single structured log event
+ * 
+ * The event is encoded while the fields are added, directly into a fixed buffer, as a single JSON object:
+ * {"ts":<nanoseconds since the unix epoch>,"level":"INFO","msg":"<message>","<key>":<value>,...}
+ * The structure is small enough to live on the stack and never allocates.
+ */
+typedef struct s_LogEvent {
+    /**
+     * @brief the encoded event
+     */
+    char buffer[GLGE_LOG_EVENT_CAPACITY];
+    /**
+     * @brief the amount of used bytes of the buffer
+     */
+    uint32_t size;
+    /**
+     * @brief the level of the event
+     */
+    LogLevel level;
+    /**
+     * @brief true if at least one field was dropped because the buffer was full
+     */
+    bool truncated;
+    /**
+     * @brief true once the event was closed. No fields can be added afterwards.
+     */
+    bool finished;
+
+    //add a chaining interface for C++
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new Log Event
+     * 
+     * @param _level the level of the event
+     * @param message the message of the event
+     */
+    inline s_LogEvent(LogLevel _level, const char* message) noexcept;
+
+    /**
+     * @brief add an integer field
+     * 
+     * @param key the name of the field
+     * @param value the value of the field
+     * @return s_LogEvent& a reference to the event to chain calls
+     */
+    inline s_LogEvent& add(const char* key, int64_t value) noexcept;
+
+    /**
+     * @brief add an integer field
+     * 
+     * @param key the name of the field
+     * @param value the value of the field
+     * @return s_LogEvent& a reference to the event to chain calls
+     */
+    inline s_LogEvent& add(const char* key, int32_t value) noexcept {return add(key, (int64_t)value);}
+
+    /**
+     * @brief add an unsigned integer field
+     * 
+     * @param key the name of the field
+     * @param value the value of the field
+     * @return s_LogEvent& a reference to the event to chain calls
+     */
+    inline s_LogEvent& add(const char* key, uint64_t value) noexcept;
+
+    /**
+     * @brief add a floating point field
+     * 
+     * @param key the name of the field
+     * @param value the value of the field. Not-finite values are stored as null.
+     * @return s_LogEvent& a reference to the event to chain calls
+     */
+    inline s_LogEvent& add(const char* key, double value) noexcept;
+
+    /**
+     * @brief add a string field
+     * 
+     * @param key the name of the field
+     * @param value the value of the field. NULL is stored as null.
+     * @return s_LogEvent& a reference to the event to chain calls
+     */
+    inline s_LogEvent& add(const char* key, const char* value) noexcept;
+
+    /**
+     * @brief add a boolean field
+     * 
+     * @param key the name of the field
+     * @param value the value of the field
+     * @return s_LogEvent& a reference to the event to chain calls
+     */
+    inline s_LogEvent& add(const char* key, bool value) noexcept;
+
+    #endif
+
+} LogEvent;
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief start a new log event. Any previous content of the event is discarded.
+ * 
+ * @param level the level of the event
+ * @param message the message of the event
+ * @param event the event to start
+ */
+void logEvent_Begin(LogLevel level, const char* message, LogEvent* event);
+
+/**
+ * @brief add an integer field to a log event
+ * 
+ * @param key the name of the field
+ * @param value the value of the field
+ * @param event the event to add the field to
+ */
+void logEvent_AddInt(const char* key, int64_t value, LogEvent* event);
+
+/**
+ * @brief add an unsigned integer field to a log event
+ * 
+ * @param key the name of the field
+ * @param value the value of the field
+ * @param event the event to add the field to
+ */
+void logEvent_AddUInt(const char* key, uint64_t value, LogEvent* event);
+
+/**
+ * @brief add a floating point field to a log event
+ * 
+ * @param key the name of the field
+ * @param value the value of the field. Not-finite values are stored as null.
+ * @param event the event to add the field to
+ */
+void logEvent_AddFloat(const char* key, double value, LogEvent* event);
+
+/**
+ * @brief add a string field to a log event
+ * 
+ * @param key the name of the field
+ * @param value the value of the field. NULL is stored as null.
+ * @param event the event to add the field to
+ */
+void logEvent_AddString(const char* key, const char* value, LogEvent* event);
+
+/**
+ * @brief add a boolean field to a log event
+ * 
+ * @param key the name of the field
+ * @param value the value of the field
+ * @param event the event to add the field to
+ */
+void logEvent_AddBool(const char* key, bool value, LogEvent* event);
+
+/**
+ * @brief close the JSON object of a log event. Called by the logger, calling it multiple times has no effect.
+ * 
+ * @param event the event to finish
+ * @return const char* a pointer to the encoded event. Not null terminated, the size is stored in the event.
+ */
+const char* logEvent_Finish(LogEvent* event);
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+//implement the C++ interface using the C functions
+#if __cplusplus
+
+inline s_LogEvent::s_LogEvent(LogLevel _level, const char* message) noexcept {logEvent_Begin(_level, message, this);}
+
+inline s_LogEvent& s_LogEvent::add(const char* key, int64_t value) noexcept {logEvent_AddInt(key, value, this); return *this;}
+
+inline s_LogEvent& s_LogEvent::add(const char* key, uint64_t value) noexcept {logEvent_AddUInt(key, value, this); return *this;}
+
+inline s_LogEvent& s_LogEvent::add(const char* key, double value) noexcept {logEvent_AddFloat(key, value, this); return *this;}
+
+inline s_LogEvent& s_LogEvent::add(const char* key, const char* value) noexcept {logEvent_AddString(key, value, this); return *this;}
+
+inline s_LogEvent& s_LogEvent::add(const char* key, bool value) noexcept {logEvent_AddBool(key, value, this); return *this;}
+
+#endif
+
+#endif
@@ -0,0 +1,192 @@
+/**
+ * @file Clock.cpp
+ * @author DM8AT
+ * @brief implement the source selection and calibration of the high resolution clock
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the clock
+#include "Clock.h"
+
+//the fallback for platforms without a direct monotonic clock call
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+//the CPU features are read with cpuid on x86
+#if GLGE_CLOCK_HAS_TSC && !defined(_MSC_VER)
+#include <x86intrin.h>
+#include <cpuid.h>
+#endif
+
+//linux has a direct call for the monotonic clock
+#if __linux
+#include <time.h>
+#endif
+
+/**
+ * @brief the time the time stamp counter is calibrated for in nanoseconds
+ */
+#define GLGE_CLOCK_CALIBRATION_NS 5000000ull
+
+/**
+ * @brief store the selected source and the calibration
+ */
+struct ClockState
+{
+    /**
+     * @brief the source of the ticks
+     */
+    ClockSource source = GLGE_CLOCK_SOURCE_MONOTONIC;
+    /**
+     * @brief the length of a tick in nanoseconds
+     */
+    double nanosecondsPerTick = 1.;
+    /**
+     * @brief the amount of ticks per second
+     */
+    double ticksPerSecond = 1000000000.;
+};
+
+#if GLGE_CLOCK_HAS_TSC
+
+/**
+ * @brief read the time stamp counter
+ * 
+ * @return uint64_t the current value of the counter
+ */
+static inline uint64_t __clockReadTsc() {return (uint64_t)__rdtsc();}
+
+/**
+ * @brief check if the CPU has an invariant time stamp counter, which runs at a constant rate in all power states
+ * 
+ * @return true : the counter is invariant
+ * @return false : the counter is not invariant or can't be checked
+ */
+static bool __clockTscInvariant()
+{
+    #if defined(_MSC_VER)
+    int regs[4];
+    __cpuid(regs, 0x80000000);
+    if ((unsigned int)regs[0] < 0x80000007u) {return false;}
+    __cpuid(regs, 0x80000007);
+    return (regs[3] >> 8) & 1;
+    #else
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid_max(0x80000000u, nullptr) < 0x80000007u) {return false;}
+    if (!__get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx)) {return false;}
+    return (edx >> 8) & 1;
+    #endif
+}
+
+/**
+ * @brief check if the operating system trusts the time stamp counter. Linux switches away from it if it is unstable,
+ * e.g. on some virtual machines or multi socket systems.
+ * 
+ * @return true : the counter can be used
+ * @return false : the operating system uses another clock source
+ */
+static bool __clockTscTrusted()
+{
+    #if __linux
+    FILE* file = fopen("/sys/devices/system/clocksource/clocksource0/current_clocksource", "r");
+    //without the information, the check of the CPU has to be enough
+    if (!file) {return true;}
+    char name[32] = {0};
+    bool tsc = fgets(name, sizeof(name), file) && (strncmp(name, "tsc", 3) == 0);
+    fclose(file);
+    return tsc;
+    #else
+    return true;
+    #endif
+}
+
+#endif
+
+/**
+ * @brief select the source and calibrate it
+ * 
+ * @return ClockState the state of the clock
+ */
+static ClockState __clockInit()
+{
+    ClockState state;
+    #if GLGE_CLOCK_HAS_TSC
+    if (!__clockTscInvariant() || !__clockTscTrusted()) {return state;}
+
+    //take pairs of counter and monotonic time. The monotonic read is bracketed by two counter reads, the midpoint is
+    //used, so the latency of the monotonic clock does not distort the calibration.
+    auto sample = [](uint64_t& tsc, uint64_t& ns) {
+        uint64_t before = __clockReadTsc();
+        ns = clock_MonotonicNanoseconds();
+        uint64_t after = __clockReadTsc();
+        tsc = before + (after - before) / 2;
+    };
+    uint64_t tsc0, ns0, tsc1, ns1;
+    sample(tsc0, ns0);
+    do {sample(tsc1, ns1);} while (ns1 - ns0 < GLGE_CLOCK_CALIBRATION_NS);
+
+    //a counter that did not advance sensibly is not used
+    if (tsc1 <= tsc0) {return state;}
+    state.source = GLGE_CLOCK_SOURCE_TSC;
+    state.nanosecondsPerTick = (double)(ns1 - ns0) / (double)(tsc1 - tsc0);
+    state.ticksPerSecond = 1000000000. / state.nanosecondsPerTick;
+    #endif
+    return state;
+}
+
+/**
+ * @brief get the state of the clock. It is initialized on first use.
+ * 
+ * @return const ClockState& the state of the clock
+ */
+static inline const ClockState& __clockState()
+{
+    static const ClockState state = __clockInit();
+    return state;
+}
+
+extern "C" {
+
+Atomic32 __glgeClockSource = GLGE_ATOMIC_INIT(0);
+
+ClockSource clock_Source() {return __clockState().source;}
+
+uint64_t clock_InitTicks()
+{
+    //publish the source for the inlined tick reads. All threads store the same value, so no ordering is needed.
+    ClockSource source = __clockState().source;
+    atomic32_Store((uint32_t)source + 1, GLGE_ATOMIC_RELAXED, &__glgeClockSource);
+    #if GLGE_CLOCK_HAS_TSC
+    if (source == GLGE_CLOCK_SOURCE_TSC) {return __clockReadTsc();}
+    #endif
+    return clock_MonotonicNanoseconds();
+}
+
+double clock_TicksPerSecond() {return __clockState().ticksPerSecond;}
+
+uint64_t clock_TicksToNanoseconds(uint64_t ticks)
+{
+    const ClockState& state = __clockState();
+    if (state.source == GLGE_CLOCK_SOURCE_MONOTONIC) {return ticks;}
+    return (uint64_t)((double)ticks * state.nanosecondsPerTick);
+}
+
+double clock_TicksToSeconds(uint64_t ticks) {return (double)ticks / __clockState().ticksPerSecond;}
+
+uint64_t clock_MonotonicNanoseconds()
+{
+    #if __linux
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+    #else
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    #endif
+}
+
+}
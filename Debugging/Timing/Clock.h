@@ -0,0 +1,134 @@
+/**
+ * @file Clock.h
+ * @author DM8AT
+ * @brief define a monotonic high resolution clock that uses the invariant time stamp counter where it is reliable
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_BG_CLOCK_
+#define _GLGE_BG_CLOCK_
+
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+//the selected source is cached in an atomic, so reading the ticks needs no call
+#include "../../CBinding/Atomic.h"
+
+//the time stamp counter is only available on x86
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define GLGE_CLOCK_HAS_TSC 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#else
+#define GLGE_CLOCK_HAS_TSC 0
+#endif
+
+/**
+ * @brief define the sources the clock can read its ticks from
+ */
+typedef enum e_ClockSource {
+    /**
+     * @brief the monotonic clock of the operating system. A tick is a nanosecond.
+     */
+    GLGE_CLOCK_SOURCE_MONOTONIC = 0,
+    /**
+     * @brief the invariant time stamp counter of the CPU, calibrated against the monotonic clock
+     */
+    GLGE_CLOCK_SOURCE_TSC
+} ClockSource;
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief get the source the clock uses. It is selected on first use of the clock and never changes.
+ * 
+ * The time stamp counter is only used if the CPU reports it as invariant and the operating system trusts it as well.
+ * Else, the monotonic clock of the operating system is used.
+ * 
+ * @return ClockSource the source of the ticks
+ */
+ClockSource clock_Source();
+
+/**
+ * @brief the selected source plus one or 0 while the clock is not initialized. Only written by the clock itself,
+ * cached here so clock_Ticks can be inlined.
+ */
+extern Atomic32 __glgeClockSource;
+
+/**
+ * @brief select and calibrate the source of the clock if that did not happen yet, then read the ticks
+ * 
+ * @return uint64_t the current ticks
+ */
+uint64_t clock_InitTicks();
+
+/**
+ * @brief get the amount of ticks per second
+ * 
+ * @return double the frequency of the clock in hertz
+ */
+double clock_TicksPerSecond();
+
+/**
+ * @brief convert an amount of ticks to nanoseconds
+ * 
+ * @param ticks the ticks to convert, e.g. the difference of two clock_Ticks calls
+ * @return uint64_t the ticks in nanoseconds
+ */
+uint64_t clock_TicksToNanoseconds(uint64_t ticks);
+
+/**
+ * @brief convert an amount of ticks to seconds
+ * 
+ * @param ticks the ticks to convert, e.g. the difference of two clock_Ticks calls
+ * @return double the ticks in seconds
+ */
+double clock_TicksToSeconds(uint64_t ticks);
+
+/**
+ * @brief read the monotonic clock of the operating system, independent of the selected source
+ * 
+ * @return uint64_t the current time in nanoseconds since an unspecified point in the past
+ */
+uint64_t clock_MonotonicNanoseconds();
+
+/**
+ * @brief read the raw ticks of the clock. Ticks only increase, but their length depends on the source.
+ * 
+ * @return uint64_t the current ticks
+ */
+static inline uint64_t clock_Ticks()
+{
+    uint32_t source = atomic32_Load(GLGE_ATOMIC_RELAXED, &__glgeClockSource);
+    #if GLGE_CLOCK_HAS_TSC
+    if (source == GLGE_CLOCK_SOURCE_TSC + 1)
+    {
+        #if defined(_MSC_VER)
+        return (uint64_t)__rdtsc();
+        #else
+        return (uint64_t)__builtin_ia32_rdtsc();
+        #endif
+    }
+    #endif
+    if (source == GLGE_CLOCK_SOURCE_MONOTONIC + 1) {return clock_MonotonicNanoseconds();}
+    return clock_InitTicks();
+}
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+#endif
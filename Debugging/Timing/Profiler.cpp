@@ -0,0 +1,455 @@
+/**
+ * @file Profiler.cpp
+ * @author DM8AT
+ * @brief implement the per-thread call trees of the profiler and the snapshots
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the profiler
+#include "Profiler.h"
+
+//memory management stuff
+#include <cstring>
+#include <cstdio>
+#include <mutex>
+#include <map>
+#include <string>
+#include <algorithm>
+#include <thread>
+
+//include the platform's thread identifiers
+#if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+#include <windows.h>
+#elif __linux
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+
+/**
+ * @brief the index of a node that does not exist
+ */
+#define GLGE_PROFILER_NO_NODE UINT32_MAX
+
+/**
+ * @brief store a single node of the call tree of a thread
+ */
+struct ProfilerNode
+{
+    /**
+     * @brief the name of the scope
+     */
+    const char* name;
+    /**
+     * @brief the index of the parent node. The root node is its own parent.
+     */
+    uint32_t parent;
+    /**
+     * @brief the index of the first child or GLGE_PROFILER_NO_NODE
+     */
+    uint32_t firstChild;
+    /**
+     * @brief the index of the next child of the parent or GLGE_PROFILER_NO_NODE
+     */
+    uint32_t nextSibling;
+    /**
+     * @brief the amount of times the scope was left
+     */
+    uint64_t count;
+    /**
+     * @brief the ticks spent in the scope
+     */
+    uint64_t total;
+    /**
+     * @brief the ticks spent in the child scopes
+     */
+    uint64_t children;
+    /**
+     * @brief the shortest execution in ticks
+     */
+    uint64_t min;
+    /**
+     * @brief the longest execution in ticks
+     */
+    uint64_t max;
+};
+
+/**
+ * @brief store the call tree of a single thread
+ */
+struct ProfilerThread
+{
+    /**
+     * @brief the identifier of the thread
+     */
+    uint64_t id = 0;
+    /**
+     * @brief protects the tree against snapshots. Only contended while a snapshot is taken.
+     */
+    std::mutex mutex;
+    /**
+     * @brief the nodes of the tree. The first node is the root, it is no scope.
+     */
+    std::vector<ProfilerNode> nodes;
+    /**
+     * @brief the index of the current scope
+     */
+    uint32_t current = 0;
+    /**
+     * @brief false once the thread finished. Only accessed with the registry mutex locked.
+     */
+    bool alive = true;
+};
+
+/**
+ * @brief store all threads that recorded scopes
+ */
+struct ProfilerRegistry
+{
+    /**
+     * @brief protects the list of threads
+     */
+    std::mutex mutex;
+    /**
+     * @brief the threads. Finished threads are kept till the next resetting snapshot.
+     */
+    std::vector<ProfilerThread*> threads;
+};
+
+/**
+ * @brief get the registry of all threads. It is never destroyed, so threads can finish during the shutdown.
+ * 
+ * @return ProfilerRegistry& a reference to the registry
+ */
+static ProfilerRegistry& __profilerRegistry()
+{
+    static ProfilerRegistry* registry = new ProfilerRegistry();
+    return *registry;
+}
+
+/**
+ * @brief mark the tree of a thread as finished once the thread ends
+ */
+struct ProfilerThreadHandle
+{
+    /**
+     * @brief the tree of the thread or NULL if the thread did not record anything
+     */
+    ProfilerThread* thread = nullptr;
+
+    /**
+     * @brief Destroy the Profiler Thread Handle. The tree is kept for the next snapshot.
+     */
+    ~ProfilerThreadHandle()
+    {
+        if (!thread) {return;}
+        std::lock_guard<std::mutex> guard(__profilerRegistry().mutex);
+        thread->alive = false;
+    }
+};
+
+/**
+ * @brief the tree of the calling thread
+ */
+static thread_local ProfilerThreadHandle __profilerThreadHandle;
+
+/**
+ * @brief get the tree of the calling thread, create it on first use
+ * 
+ * @return ProfilerThread* a pointer to the tree
+ */
+static ProfilerThread* __profilerThread()
+{
+    if (__profilerThreadHandle.thread) {return __profilerThreadHandle.thread;}
+    ProfilerThread* thread = new ProfilerThread();
+    thread->id = profiler_CurrentThreadId();
+    thread->nodes.push_back({"", 0, GLGE_PROFILER_NO_NODE, GLGE_PROFILER_NO_NODE, 0, 0, 0, UINT64_MAX, 0});
+    {
+        ProfilerRegistry& registry = __profilerRegistry();
+        std::lock_guard<std::mutex> guard(registry.mutex);
+        registry.threads.push_back(thread);
+    }
+    __profilerThreadHandle.thread = thread;
+    return thread;
+}
+
+/**
+ * @brief sort nodes depth first, with the children of each node sorted by their total time, and fill in the depths
+ * 
+ * @param nodes the nodes to sort. The parents must be valid indices into the nodes.
+ * @return std::vector<ProfilerNodeInfo> the sorted nodes
+ */
+static std::vector<ProfilerNodeInfo> __profilerOrder(const std::vector<ProfilerNodeInfo>& nodes)
+{
+    //collect the children of each node and the top level nodes
+    std::vector<std::vector<uint32_t>> children(nodes.size());
+    std::vector<uint32_t> roots;
+    for (uint32_t i = 0; i < nodes.size(); ++i)
+    {
+        if (nodes[i].parent == GLGE_PROFILER_NO_PARENT) {roots.push_back(i);}
+        else {children[nodes[i].parent].push_back(i);}
+    }
+    auto byTotal = [&](uint32_t a, uint32_t b) {return nodes[a].totalNs > nodes[b].totalNs;};
+    std::sort(roots.begin(), roots.end(), byTotal);
+    for (std::vector<uint32_t>& list : children) {std::sort(list.begin(), list.end(), byTotal);}
+
+    //walk the tree depth first. The stack holds the old index and the new index of the parent.
+    std::vector<ProfilerNodeInfo> ordered;
+    ordered.reserve(nodes.size());
+    std::vector<std::pair<uint32_t, uint32_t>> stack;
+    for (auto it = roots.rbegin(); it != roots.rend(); ++it) {stack.push_back({*it, GLGE_PROFILER_NO_PARENT});}
+    while (!stack.empty())
+    {
+        auto [index, parent] = stack.back();
+        stack.pop_back();
+        ProfilerNodeInfo node = nodes[index];
+        node.parent = parent;
+        node.depth = (parent == GLGE_PROFILER_NO_PARENT) ? 0 : ordered[parent].depth + 1;
+        uint32_t self = (uint32_t)ordered.size();
+        ordered.push_back(node);
+        for (auto it = children[index].rbegin(); it != children[index].rend(); ++it) {stack.push_back({*it, self});}
+    }
+    return ordered;
+}
+
+/**
+ * @brief copy the tree of a thread. The mutex of the thread must be locked.
+ * 
+ * @param thread the thread to copy
+ * @return ProfilerSnapshot::Tree the copy of the tree
+ */
+static ProfilerSnapshot::Tree __profilerCopy(const ProfilerThread& thread)
+{
+    //only keep nodes that were left at least once or have such a descendant. Children always have larger indices
+    //than their parents, so a single backwards pass is enough.
+    const std::vector<ProfilerNode>& nodes = thread.nodes;
+    std::vector<bool> used(nodes.size(), false);
+    for (size_t i = nodes.size() - 1; i > 0; --i)
+    {
+        used[i] = used[i] || (nodes[i].count != 0);
+        if (used[i]) {used[nodes[i].parent] = true;}
+    }
+
+    //convert the used nodes, the root is left out
+    std::vector<uint32_t> remap(nodes.size(), GLGE_PROFILER_NO_PARENT);
+    std::vector<ProfilerNodeInfo> infos;
+    for (uint32_t i = 1; i < nodes.size(); ++i)
+    {
+        if (!used[i]) {continue;}
+        const ProfilerNode& node = nodes[i];
+        uint64_t self = (node.total > node.children) ? node.total - node.children : 0;
+        remap[i] = (uint32_t)infos.size();
+        infos.push_back({node.name, remap[node.parent], 0, node.count, clock_TicksToNanoseconds(node.total),
+                         clock_TicksToNanoseconds(self), (node.count != 0) ? clock_TicksToNanoseconds(node.min) : 0,
+                         clock_TicksToNanoseconds(node.max)});
+    }
+
+    ProfilerSnapshot::Tree tree;
+    tree.threadId = thread.id;
+    tree.nodes = __profilerOrder(infos);
+    return tree;
+}
+
+/**
+ * @brief write a string as quoted JSON string
+ * 
+ * @param file the file to write to
+ * @param str the string to write
+ */
+static void __profilerJsonString(FILE* file, const char* str)
+{
+    fputc('"', file);
+    for (const unsigned char* c = (const unsigned char*)str; *c; ++c)
+    {
+        if ((*c == '"') || (*c == '\\')) {fputc('\\', file); fputc(*c, file);}
+        else if (*c < 0x20) {fprintf(file, "\\u%04x", *c);}
+        else {fputc(*c, file);}
+    }
+    fputc('"', file);
+}
+
+s_ProfilerSnapshot s_ProfilerSnapshot::merged() const
+{
+    //nodes are identified by the merged index of their parent and their name
+    std::map<std::pair<uint32_t, std::string>, uint32_t> lookup;
+    std::vector<ProfilerNodeInfo> nodes;
+    for (const Tree& tree : trees)
+    {
+        //the nodes are depth first, so the parent is always mapped before its children
+        std::vector<uint32_t> remap(tree.nodes.size());
+        for (uint32_t i = 0; i < tree.nodes.size(); ++i)
+        {
+            const ProfilerNodeInfo& node = tree.nodes[i];
+            uint32_t parent = (node.parent == GLGE_PROFILER_NO_PARENT) ? GLGE_PROFILER_NO_PARENT : remap[node.parent];
+            auto [it, inserted] = lookup.try_emplace({parent, node.name}, (uint32_t)nodes.size());
+            remap[i] = it->second;
+            if (inserted)
+            {
+                nodes.push_back(node);
+                nodes.back().parent = parent;
+                continue;
+            }
+            ProfilerNodeInfo& target = nodes[it->second];
+            target.minNs = (target.count == 0) ? node.minNs : ((node.count != 0) ? std::min(target.minNs, node.minNs) : target.minNs);
+            target.maxNs = std::max(target.maxNs, node.maxNs);
+            target.count += node.count;
+            target.totalNs += node.totalNs;
+            target.selfNs += node.selfNs;
+        }
+    }
+
+    s_ProfilerSnapshot result;
+    result.trees.push_back({0, __profilerOrder(nodes)});
+    return result;
+}
+
+void s_ProfilerSnapshot::print() const
+{
+    for (const Tree& tree : trees)
+    {
+        if (tree.threadId != 0) {printf("thread %llu\n", (unsigned long long)tree.threadId);}
+        else {printf("all threads\n");}
+        printf("%-48s %10s %12s %12s %12s %12s\n", "scope", "count", "total ms", "self ms", "min us", "max us");
+        for (const ProfilerNodeInfo& node : tree.nodes)
+        {
+            int indent = (int)node.depth * 2;
+            int width = (indent < 46) ? 48 - indent : 2;
+            printf("%*s%-*s %10llu %12.3f %12.3f %12.3f %12.3f\n", indent, "", width, node.name, (unsigned long long)node.count,
+                   node.totalNs / 1e6, node.selfNs / 1e6, node.minNs / 1e3, node.maxNs / 1e3);
+        }
+    }
+    fflush(stdout);
+}
+
+bool s_ProfilerSnapshot::writeJson(const char* path) const
+{
+    FILE* file = fopen(path, "w");
+    if (!file) {return false;}
+    fputs("{\"threads\":[", file);
+    for (size_t t = 0; t < trees.size(); ++t)
+    {
+        fprintf(file, "%s{\"thread\":%llu,\"nodes\":[", (t == 0) ? "" : ",", (unsigned long long)trees[t].threadId);
+        for (size_t i = 0; i < trees[t].nodes.size(); ++i)
+        {
+            const ProfilerNodeInfo& node = trees[t].nodes[i];
+            fputs((i == 0) ? "{\"name\":" : ",{\"name\":", file);
+            __profilerJsonString(file, node.name);
+            fprintf(file, ",\"parent\":%lld,\"depth\":%u,\"count\":%llu,\"totalNs\":%llu,\"selfNs\":%llu,\"minNs\":%llu,\"maxNs\":%llu}",
+                    (node.parent == GLGE_PROFILER_NO_PARENT) ? -1ll : (long long)node.parent, node.depth, (unsigned long long)node.count,
+                    (unsigned long long)node.totalNs, (unsigned long long)node.selfNs, (unsigned long long)node.minNs, (unsigned long long)node.maxNs);
+        }
+        fputs("]}", file);
+    }
+    fputs("]}\n", file);
+    return fclose(file) == 0;
+}
+
+extern "C" {
+
+void profiler_Enter(const char* name)
+{
+    ProfilerThread* thread = __profilerThread();
+    std::lock_guard<std::mutex> guard(thread->mutex);
+    std::vector<ProfilerNode>& nodes = thread->nodes;
+
+    //find the child of the current scope with the same name. Names are usually literals, so the pointer matches.
+    uint32_t parent = thread->current;
+    uint32_t child = nodes[parent].firstChild;
+    while ((child != GLGE_PROFILER_NO_NODE) && (nodes[child].name != name) && (strcmp(nodes[child].name, name) != 0))
+    {child = nodes[child].nextSibling;}
+
+    //the first execution of a scope creates its node
+    if (child == GLGE_PROFILER_NO_NODE)
+    {
+        child = (uint32_t)nodes.size();
+        nodes.push_back({name, parent, GLGE_PROFILER_NO_NODE, nodes[parent].firstChild, 0, 0, 0, UINT64_MAX, 0});
+        nodes[parent].firstChild = child;
+    }
+    thread->current = child;
+}
+
+void profiler_Leave(uint64_t ticks)
+{
+    ProfilerThread* thread = __profilerThread();
+    std::lock_guard<std::mutex> guard(thread->mutex);
+    //ignore unbalanced calls
+    uint32_t current = thread->current;
+    if (current == 0) {return;}
+
+    ProfilerNode& node = thread->nodes[current];
+    ++node.count;
+    node.total += ticks;
+    node.min = (ticks < node.min) ? ticks : node.min;
+    node.max = (ticks > node.max) ? ticks : node.max;
+    thread->nodes[node.parent].children += ticks;
+    thread->current = node.parent;
+}
+
+ProfilerSnapshot* profiler_Snapshot(bool reset)
+{
+    ProfilerSnapshot* snapshot = new ProfilerSnapshot();
+    ProfilerRegistry& registry = __profilerRegistry();
+    std::lock_guard<std::mutex> guard(registry.mutex);
+
+    for (ProfilerThread* thread : registry.threads)
+    {
+        std::lock_guard<std::mutex> threadGuard(thread->mutex);
+        snapshot->trees.push_back(__profilerCopy(*thread));
+        if (!reset) {continue;}
+        //keep the nodes, a scope may still be open
+        for (ProfilerNode& node : thread->nodes)
+        {
+            node.count = 0;
+            node.total = 0;
+            node.children = 0;
+            node.min = UINT64_MAX;
+            node.max = 0;
+        }
+    }
+
+    //finished threads are reported a last time, then removed
+    if (reset)
+    {
+        auto end = std::remove_if(registry.threads.begin(), registry.threads.end(), [](ProfilerThread* thread) {
+            if (thread->alive) {return false;}
+            delete thread;
+            return true;
+        });
+        registry.threads.erase(end, registry.threads.end());
+    }
+    return snapshot;
+}
+
+void profilerSnapshot_Destroy(ProfilerSnapshot* snapshot) {delete snapshot;}
+
+ProfilerSnapshot* profilerSnapshot_Merge(const ProfilerSnapshot* snapshot) {return new ProfilerSnapshot(snapshot->merged());}
+
+uint32_t profilerSnapshot_TreeCount(const ProfilerSnapshot* snapshot) {return (uint32_t)snapshot->trees.size();}
+
+uint64_t profilerSnapshot_ThreadId(uint32_t tree, const ProfilerSnapshot* snapshot) {return snapshot->trees[tree].threadId;}
+
+uint32_t profilerSnapshot_NodeCount(uint32_t tree, const ProfilerSnapshot* snapshot) {return (uint32_t)snapshot->trees[tree].nodes.size();}
+
+const ProfilerNodeInfo* profilerSnapshot_GetNode(uint32_t tree, uint32_t node, const ProfilerSnapshot* snapshot) {return &snapshot->trees[tree].nodes[node];}
+
+void profilerSnapshot_Print(const ProfilerSnapshot* snapshot) {snapshot->print();}
+
+bool profilerSnapshot_WriteJson(const char* path, const ProfilerSnapshot* snapshot) {return snapshot->writeJson(path);}
+
+uint64_t profiler_CurrentThreadId()
+{
+    #if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+    return (uint64_t)GetCurrentThreadId();
+    #elif __linux
+    //cache the system call
+    static thread_local uint64_t id = (uint64_t)syscall(SYS_gettid);
+    return id;
+    #else
+    return (uint64_t)std::hash<std::thread::id>()(std::this_thread::get_id());
+    #endif
+}
+
+}
@@ -0,0 +1,244 @@
+/**
+ * @file Profiler.h
+ * @author DM8AT
+ * @brief define a hierarchical profiler that records timed scopes into a call tree per thread
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_BG_PROFILER_
+#define _GLGE_BG_PROFILER_
+
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+//the scopes are measured in clock ticks
+#include "Clock.h"
+
+//include containers for C++
+#if __cplusplus
+#include <vector>
+#endif
+
+/**
+ * @brief the parent index of the nodes at the top of a tree
+ */
+#define GLGE_PROFILER_NO_PARENT UINT32_MAX
+
+/**
+ * @brief store the statistics of a single node of a profiler tree
+ */
+typedef struct s_ProfilerNodeInfo {
+    /**
+     * @brief the name of the scope
+     */
+    const char* name;
+    /**
+     * @brief the index of the parent node or GLGE_PROFILER_NO_PARENT
+     */
+    uint32_t parent;
+    /**
+     * @brief the depth of the node, 0 for the top level scopes
+     */
+    uint32_t depth;
+    /**
+     * @brief the amount of times the scope was left
+     */
+    uint64_t count;
+    /**
+     * @brief the time spent in the scope in nanoseconds, including the child scopes
+     */
+    uint64_t totalNs;
+    /**
+     * @brief the time spent in the scope in nanoseconds, without the child scopes
+     */
+    uint64_t selfNs;
+    /**
+     * @brief the shortest single execution in nanoseconds
+     */
+    uint64_t minNs;
+    /**
+     * @brief the longest single execution in nanoseconds
+     */
+    uint64_t maxNs;
+} ProfilerNodeInfo;
+
+/**
+ * @brief store a copy of the profiler trees of all threads at a single point in time
+ * 
+ * The nodes of each tree are stored depth first. The children of a node directly follow it, sorted by their total time.
+ */
+typedef struct s_ProfilerSnapshot {
+
+    //check for C++ to define the snapshot
+    #if __cplusplus
+
+    /**
+     * @brief store the tree of a single thread
+     */
+    struct Tree
+    {
+        /**
+         * @brief the identifier of the thread or 0 for merged trees
+         */
+        uint64_t threadId = 0;
+        /**
+         * @brief the nodes of the tree, depth first
+         */
+        std::vector<ProfilerNodeInfo> nodes;
+    };
+
+    /**
+     * @brief create a snapshot with a single tree that combines the trees of all threads. Nodes with the same path of names are combined.
+     * 
+     * @return s_ProfilerSnapshot the merged snapshot
+     */
+    s_ProfilerSnapshot merged() const;
+
+    /**
+     * @brief print the trees to the standard output, indented by depth
+     */
+    void print() const;
+
+    /**
+     * @brief write the trees to a JSON file
+     * 
+     * @param path the path of the file to create
+     * @return true : the file was written
+     * @return false : the file could not be created
+     */
+    bool writeJson(const char* path) const;
+
+    /**
+     * @brief the trees of the threads
+     */
+    std::vector<Tree> trees;
+
+    #else
+
+    //for windows, add a single byte here to make the struct contain something
+    uint8_t byte;
+
+    #endif
+
+    //for C, this is an opaque structure
+
+} ProfilerSnapshot;
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief enter a scope on the calling thread. The scope becomes a child of the current scope.
+ * 
+ * Only a per-thread tree is updated, there is no I/O. The name is stored as pointer and must stay valid, e.g. a string literal.
+ * 
+ * @param name the name of the scope
+ */
+void profiler_Enter(const char* name);
+
+/**
+ * @brief leave the current scope of the calling thread
+ * 
+ * @param ticks the time spent in the scope in clock ticks
+ */
+void profiler_Leave(uint64_t ticks);
+
+/**
+ * @brief copy the trees of all threads that recorded scopes
+ * 
+ * @param reset true to reset the statistics afterwards, e.g. at the end of a frame
+ * @return ProfilerSnapshot* a pointer to the new snapshot
+ */
+ProfilerSnapshot* profiler_Snapshot(bool reset);
+
+/**
+ * @brief destroy a profiler snapshot
+ * 
+ * @param snapshot the snapshot to destroy
+ */
+void profilerSnapshot_Destroy(ProfilerSnapshot* snapshot);
+
+/**
+ * @brief create a snapshot with a single tree that combines the trees of all threads of a snapshot
+ * 
+ * @param snapshot the snapshot to merge
+ * @return ProfilerSnapshot* a pointer to the new, merged snapshot
+ */
+ProfilerSnapshot* profilerSnapshot_Merge(const ProfilerSnapshot* snapshot);
+
+/**
+ * @brief get the amount of trees of a snapshot
+ * 
+ * @param snapshot the snapshot to quarry
+ * @return uint32_t the amount of trees
+ */
+uint32_t profilerSnapshot_TreeCount(const ProfilerSnapshot* snapshot);
+
+/**
+ * @brief get the identifier of the thread a tree of a snapshot belongs to
+ * 
+ * @param tree the index of the tree
+ * @param snapshot the snapshot to quarry
+ * @return uint64_t the identifier of the thread or 0 for merged trees
+ */
+uint64_t profilerSnapshot_ThreadId(uint32_t tree, const ProfilerSnapshot* snapshot);
+
+/**
+ * @brief get the amount of nodes of a tree of a snapshot
+ * 
+ * @param tree the index of the tree
+ * @param snapshot the snapshot to quarry
+ * @return uint32_t the amount of nodes
+ */
+uint32_t profilerSnapshot_NodeCount(uint32_t tree, const ProfilerSnapshot* snapshot);
+
+/**
+ * @brief get a node of a tree of a snapshot
+ * 
+ * @param tree the index of the tree
+ * @param node the index of the node
+ * @param snapshot the snapshot to quarry
+ * @return const ProfilerNodeInfo* a pointer to the node. Valid as long as the snapshot exists.
+ */
+const ProfilerNodeInfo* profilerSnapshot_GetNode(uint32_t tree, uint32_t node, const ProfilerSnapshot* snapshot);
+
+/**
+ * @brief print the trees of a snapshot to the standard output
+ * 
+ * @param snapshot the snapshot to print
+ */
+void profilerSnapshot_Print(const ProfilerSnapshot* snapshot);
+
+/**
+ * @brief write the trees of a snapshot to a JSON file
+ * 
+ * @param path the path of the file to create
+ * @param snapshot the snapshot to write
+ * @return true : the file was written
+ * @return false : the file could not be created
+ */
+bool profilerSnapshot_WriteJson(const char* path, const ProfilerSnapshot* snapshot);
+
+/**
+ * @brief get an identifier of the calling thread, the one the operating system uses where possible
+ * 
+ * @return uint64_t the identifier of the thread
+ */
+uint64_t profiler_CurrentThreadId();
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+#endif
@@ -12,6 +12,18 @@
 //include scope timers
 #include "ScopeTimer.h"
 
+//the mode is shared by all threads
+#include <atomic>
+
+/**
+ * @brief the mode new scope timers are created with
+ */
+static std::atomic<ScopeTimerMode> __scopeTimerMode{GLGE_SCOPE_TIMER_PRINT};
+
+void scopeTimer_SetMode(ScopeTimerMode mode) {__scopeTimerMode.store(mode, std::memory_order_relaxed);}
+
+ScopeTimerMode scopeTimer_GetMode() {return __scopeTimerMode.load(std::memory_order_relaxed);}
+
 ScopeTimer* scopeTimer_Create(const char* name) {return new ScopeTimer(name);}
 
 void scopeTimer_Destroy(ScopeTimer* timer) {delete timer;}
@@ -15,6 +15,62 @@
 
 //include simple timers
 #include "Timer.h"
+//scope timers can record into the profiler
+#include "Profiler.h"
+//scope timers can record into a trace
+#include "Trace.h"
+
+//the duration is printed in C++
+#if __cplusplus
+#include <cstdio>
+#endif
+
+/**
+ * @brief define what scope timers do with the measured time. The mode is read when a scope timer is created.
+ */
+typedef enum e_ScopeTimerMode {
+    /**
+     * @brief print the duration to the console when the scope ends
+     */
+    GLGE_SCOPE_TIMER_PRINT = 0,
+    /**
+     * @brief record the scope into the per-thread call tree of the profiler, without any I/O
+     */
+    GLGE_SCOPE_TIMER_PROFILE,
+    /**
+     * @brief only measure, the duration is not used
+     */
+    GLGE_SCOPE_TIMER_SILENT,
+    /**
+     * @brief record the scope as timed event of the running trace capture, without any I/O
+     */
+    GLGE_SCOPE_TIMER_TRACE
+} ScopeTimerMode;
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief set what new scope timers do with the measured time
+ * 
+ * @param mode the new mode
+ */
+void scopeTimer_SetMode(ScopeTimerMode mode);
+
+/**
+ * @brief get what new scope timers do with the measured time
+ * 
+ * @return ScopeTimerMode the current mode
+ */
+ScopeTimerMode scopeTimer_GetMode();
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
 
 //switch between C and C++ to implement a virtual class
 #if __cplusplus
@@ -25,19 +81,35 @@ struct ScopeTimer : public Timer
     /**
      * @brief Construct a new Scope Timer
      * 
-     * @param name the name of the scope timer to create
+     * @param name the name of the scope timer to create. Must stay valid till the scope ends.
      */
     ScopeTimer(const char* name)
-     : Timer(), m_name(name)
-    {}
+     : Timer(), m_name(name), m_mode(scopeTimer_GetMode())
+    {
+        //the scope is entered before the measurement starts, so the bookkeeping is not measured
+        if (m_mode == GLGE_SCOPE_TIMER_PROFILE) {profiler_Enter(name); restart();}
+    }
 
     /**
      * @brief Destroy the Scope Timer
      */
     ~ScopeTimer()
     {
-        //print the duration of the scope into the console
-        printf("%s took %f seconds\n", m_name, getDeltaTime());
+        switch (m_mode)
+        {
+        case GLGE_SCOPE_TIMER_PRINT:
+            //print the duration of the scope into the console
+            printf("%s took %f seconds\n", m_name, getDeltaTime());
+            break;
+        case GLGE_SCOPE_TIMER_PROFILE:
+            profiler_Leave(getDeltaTicks());
+            break;
+        case GLGE_SCOPE_TIMER_TRACE:
+            trace_Complete(m_name, m_start, getDeltaTicks());
+            break;
+        default:
+            break;
+        }
     }
 
 protected:
@@ -46,6 +118,10 @@ protected:
      * @brief store the name of the timer
      */
     const char* m_name;
+    /**
+     * @brief the mode the timer was created with
+     */
+    ScopeTimerMode m_mode;
 
 };
 
@@ -78,7 +154,7 @@ ScopeTimer* scopeTimer_Create(const char* name);
 /**
  * @brief delete a scope timer object
  * 
- * This will print the duration of the scope of the timer to the console
+ * Depending on the mode the timer was created with, this prints the duration of the scope or records it in the profiler or the trace
  * 
  * @param timer a pointer to the scope timer object to delete
  */
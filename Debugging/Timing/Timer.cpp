@@ -18,4 +18,6 @@ void timer_Destroy(Timer* timer) {delete timer;}
 
 void timer_Restart(Timer* timer) {timer->restart();}
 
-double timer_GetDeltaTime(Timer* timer) {return timer->getDeltaTime();}
\ No newline at end of file
+double timer_GetDeltaTime(Timer* timer) {return timer->getDeltaTime();}
+
+uint64_t timer_GetDeltaNanoseconds(Timer* timer) {return timer->getDeltaNanoseconds();}
\ No newline at end of file
@@ -13,10 +13,13 @@
 #ifndef _GLGE_BG_TIMER_
 #define _GLGE_BG_TIMER_
 
-//include timing stuff for C++
-#if __cplusplus
-#include <chrono>
-#endif
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+//the timer measures using the high resolution clock
+#include "Clock.h"
 
 /**
  * @brief store a simple timer
@@ -39,21 +42,35 @@ typedef struct s_Timer {
     /**
      * @brief re-start the timing of the timer
      */
-    inline void restart() noexcept {m_start = std::chrono::system_clock::now();}
+    inline void restart() noexcept {m_start = clock_Ticks();}
 
     /**
      * @brief Get the difference in time in seconds since the start (construction / explicit start) from the timer to the current time point
      * 
      * @return double the difference in seconds
      */
-    inline double getDeltaTime() noexcept {return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now() - m_start).count() / 1000000000.;}
+    inline double getDeltaTime() noexcept {return clock_TicksToSeconds(clock_Ticks() - m_start);}
+
+    /**
+     * @brief get the difference in raw clock ticks since the start of the timer
+     * 
+     * @return uint64_t the difference in ticks. Use clock_TicksToNanoseconds to convert it.
+     */
+    inline uint64_t getDeltaTicks() noexcept {return clock_Ticks() - m_start;}
+
+    /**
+     * @brief get the difference in nanoseconds since the start of the timer
+     * 
+     * @return uint64_t the difference in nanoseconds
+     */
+    inline uint64_t getDeltaNanoseconds() noexcept {return clock_TicksToNanoseconds(clock_Ticks() - m_start);}
 
 protected:
 
     /**
-     * @brief store the start time point
+     * @brief store the start time point in clock ticks
      */
-    std::chrono::system_clock::time_point m_start = std::chrono::system_clock::now();
+    uint64_t m_start = clock_Ticks();
 
     #else
 
@@ -99,6 +116,14 @@ void timer_Restart(Timer* timer);
  */
 double timer_GetDeltaTime(Timer* timer);
 
+/**
+ * @brief get the time difference between the calling time point and the start time point of a timer object in nanoseconds
+ * 
+ * @param timer a pointer to the timer to quarry the start time from
+ * @return uint64_t the difference in time in nanoseconds
+ */
+uint64_t timer_GetDeltaNanoseconds(Timer* timer);
+
 //the the extern section in C++
 #if __cplusplus
 }
@@ -13,9 +13,15 @@
 #ifndef _GLGE_BG_TIMING_
 #define _GLGE_BG_TIMING_
 
+//include the high resolution clock
+#include "Clock.h"
 //include the simple timer
 #include "Timer.h"
 //include scope timer
 #include "ScopeTimer.h"
+//include the hierarchical profiler
+#include "Profiler.h"
+//include the trace recording
+#include "Trace.h"
 
 #endif
\ No newline at end of file
@@ -0,0 +1,365 @@
+/**
+ * @file Trace.cpp
+ * @author DM8AT
+ * @brief implement the per-thread trace buffers and the Chrome trace export
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include tracing
+#include "Trace.h"
+//the events use the thread identifiers of the profiler
+#include "Profiler.h"
+
+//memory management stuff
+#include <cstdio>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <memory>
+#include <algorithm>
+
+//include the platform's process identifiers
+#if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+/**
+ * @brief define the kinds of recorded events
+ */
+enum TraceEventType : uint8_t
+{
+    GLGE_TRACE_EVENT_COMPLETE = 0,
+    GLGE_TRACE_EVENT_INSTANT,
+    GLGE_TRACE_EVENT_COUNTER
+};
+
+/**
+ * @brief store a single recorded event
+ */
+struct TraceEvent
+{
+    /**
+     * @brief the name of the event
+     */
+    const char* name;
+    /**
+     * @brief the time of the event in clock ticks
+     */
+    uint64_t ticks;
+    /**
+     * @brief the duration in ticks for scopes or the value for counters
+     */
+    union {
+        uint64_t duration;
+        double value;
+    };
+    /**
+     * @brief the kind of the event
+     */
+    TraceEventType type;
+};
+
+/**
+ * @brief store the events of a single thread
+ * 
+ * Only the owning thread writes events. It publishes them by increasing the count, so the exporter can read all
+ * events below the count without locking.
+ */
+struct TraceBuffer
+{
+    /**
+     * @brief the identifier of the thread
+     */
+    uint64_t threadId = 0;
+    /**
+     * @brief the capture the events belong to. Changed by the owner after it reset the buffer for a new capture.
+     */
+    std::atomic<uint64_t> session{0};
+    /**
+     * @brief the amount of recorded events
+     */
+    std::atomic<uint64_t> count{0};
+    /**
+     * @brief the amount of events that did not fit
+     */
+    std::atomic<uint64_t> dropped{0};
+    /**
+     * @brief the amount of events the buffer can hold
+     */
+    uint64_t capacity = 0;
+    /**
+     * @brief the events. Not initialized, so untouched memory is never paged in.
+     */
+    std::unique_ptr<TraceEvent[]> events;
+    /**
+     * @brief false once the thread finished. Only accessed with the registry mutex locked.
+     */
+    bool alive = true;
+};
+
+/**
+ * @brief store the global state of the tracing
+ */
+struct TraceState
+{
+    /**
+     * @brief the number of the current capture in the upper bits, the lowest bit is set while recording.
+     * Packed, so recording an event needs only a single load.
+     */
+    std::atomic<uint64_t> control{0};
+    /**
+     * @brief the amount of events each thread can record in the current capture
+     */
+    std::atomic<uint64_t> eventsPerThread{GLGE_TRACE_DEFAULT_EVENTS_PER_THREAD};
+    /**
+     * @brief the time the current capture started in clock ticks
+     */
+    uint64_t startTicks = 0;
+    /**
+     * @brief serializes starting, stopping and exporting captures as well as the list of buffers
+     */
+    std::mutex mutex;
+    /**
+     * @brief the buffers of all threads that recorded events
+     */
+    std::vector<TraceBuffer*> buffers;
+};
+
+/**
+ * @brief get the state of the tracing. It is never destroyed, so threads can finish during the shutdown.
+ * 
+ * @return TraceState& a reference to the state
+ */
+static TraceState& __traceState()
+{
+    static TraceState* state = new TraceState();
+    return *state;
+}
+
+/**
+ * @brief mark the buffer of a thread as finished once the thread ends
+ */
+struct TraceBufferHandle
+{
+    /**
+     * @brief the buffer of the thread or NULL if the thread did not record anything
+     */
+    TraceBuffer* buffer = nullptr;
+
+    /**
+     * @brief Destroy the Trace Buffer Handle. The buffer is kept till the next capture starts.
+     */
+    ~TraceBufferHandle()
+    {
+        if (!buffer) {return;}
+        std::lock_guard<std::mutex> guard(__traceState().mutex);
+        buffer->alive = false;
+    }
+};
+
+/**
+ * @brief the buffer of the calling thread
+ */
+static thread_local TraceBufferHandle __traceBufferHandle;
+
+/**
+ * @brief add an event to the buffer of the calling thread if a capture is running
+ * 
+ * @param event the event to add
+ */
+static void __traceRecord(const TraceEvent& event)
+{
+    TraceState& state = __traceState();
+    uint64_t control = state.control.load(std::memory_order_acquire);
+    if (!(control & 1)) {return;}
+    uint64_t session = control >> 1;
+
+    //create the buffer on the first event of the thread
+    TraceBuffer* buffer = __traceBufferHandle.buffer;
+    if (!buffer)
+    {
+        buffer = new TraceBuffer();
+        buffer->threadId = profiler_CurrentThreadId();
+        std::lock_guard<std::mutex> guard(state.mutex);
+        state.buffers.push_back(buffer);
+        __traceBufferHandle.buffer = buffer;
+    }
+
+    //the first event of a new capture resets the buffer. Only the owner changes the buffer, so no lock is needed.
+    if (buffer->session.load(std::memory_order_relaxed) != session)
+    {
+        buffer->count.store(0, std::memory_order_relaxed);
+        buffer->dropped.store(0, std::memory_order_relaxed);
+        uint64_t capacity = state.eventsPerThread.load(std::memory_order_relaxed);
+        if (buffer->capacity != capacity)
+        {
+            buffer->events.reset(new TraceEvent[capacity]);
+            buffer->capacity = capacity;
+        }
+        buffer->session.store(session, std::memory_order_release);
+    }
+
+    //a full buffer drops the event, so memory stays bounded
+    uint64_t count = buffer->count.load(std::memory_order_relaxed);
+    if (count >= buffer->capacity)
+    {
+        buffer->dropped.store(buffer->dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return;
+    }
+    buffer->events[count] = event;
+    buffer->count.store(count + 1, std::memory_order_release);
+}
+
+/**
+ * @brief write a string as quoted JSON string
+ * 
+ * @param file the file to write to
+ * @param str the string to write
+ */
+static void __traceJsonString(FILE* file, const char* str)
+{
+    fputc('"', file);
+    for (const unsigned char* c = (const unsigned char*)str; *c; ++c)
+    {
+        if ((*c == '"') || (*c == '\\')) {fputc('\\', file); fputc(*c, file);}
+        else if (*c < 0x20) {fprintf(file, "\\u%04x", *c);}
+        else {fputc(*c, file);}
+    }
+    fputc('"', file);
+}
+
+extern "C" {
+
+void trace_Start(const TraceCreateInfo* info)
+{
+    TraceState& state = __traceState();
+    std::lock_guard<std::mutex> guard(state.mutex);
+
+    //buffers of finished threads are not needed anymore
+    auto end = std::remove_if(state.buffers.begin(), state.buffers.end(), [](TraceBuffer* buffer) {
+        if (buffer->alive) {return false;}
+        delete buffer;
+        return true;
+    });
+    state.buffers.erase(end, state.buffers.end());
+
+    uint64_t events = (info && info->eventsPerThread) ? info->eventsPerThread : GLGE_TRACE_DEFAULT_EVENTS_PER_THREAD;
+    state.eventsPerThread.store(events, std::memory_order_relaxed);
+    state.startTicks = clock_Ticks();
+    //a new capture number makes every thread reset its buffer on its next event
+    uint64_t session = (state.control.load(std::memory_order_relaxed) >> 1) + 1;
+    state.control.store((session << 1) | 1, std::memory_order_release);
+}
+
+void trace_Stop()
+{
+    TraceState& state = __traceState();
+    std::lock_guard<std::mutex> guard(state.mutex);
+    state.control.fetch_and(~1ull, std::memory_order_release);
+}
+
+bool trace_IsRecording() {return __traceState().control.load(std::memory_order_relaxed) & 1;}
+
+void trace_Complete(const char* name, uint64_t start, uint64_t duration)
+{
+    TraceEvent event;
+    event.name = name;
+    event.ticks = start;
+    event.duration = duration;
+    event.type = GLGE_TRACE_EVENT_COMPLETE;
+    __traceRecord(event);
+}
+
+void trace_Instant(const char* name)
+{
+    TraceEvent event;
+    event.name = name;
+    event.ticks = clock_Ticks();
+    event.duration = 0;
+    event.type = GLGE_TRACE_EVENT_INSTANT;
+    __traceRecord(event);
+}
+
+void trace_Counter(const char* name, double value)
+{
+    TraceEvent event;
+    event.name = name;
+    event.ticks = clock_Ticks();
+    event.value = value;
+    event.type = GLGE_TRACE_EVENT_COUNTER;
+    __traceRecord(event);
+}
+
+uint64_t trace_DroppedCount()
+{
+    TraceState& state = __traceState();
+    std::lock_guard<std::mutex> guard(state.mutex);
+    uint64_t session = state.control.load(std::memory_order_relaxed) >> 1;
+    uint64_t dropped = 0;
+    for (TraceBuffer* buffer : state.buffers)
+    {if (buffer->session.load(std::memory_order_acquire) == session) {dropped += buffer->dropped.load(std::memory_order_relaxed);}}
+    return dropped;
+}
+
+bool trace_Export(const char* path)
+{
+    FILE* file = fopen(path, "w");
+    if (!file) {return false;}
+    //the trace is written in large blocks
+    std::vector<char> io(1 << 16);
+    setvbuf(file, io.data(), _IOFBF, io.size());
+
+    #if defined(__WIN32__) || defined(_WIN32) || defined(__CYGWIN32__)
+    int pid = _getpid();
+    #else
+    int pid = (int)getpid();
+    #endif
+
+    //the capture can't change while it is exported, so no buffer is reset while it is read
+    TraceState& state = __traceState();
+    std::lock_guard<std::mutex> guard(state.mutex);
+    uint64_t session = state.control.load(std::memory_order_relaxed) >> 1;
+    uint64_t dropped = 0;
+    bool first = true;
+
+    fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", file);
+    for (TraceBuffer* buffer : state.buffers)
+    {
+        if (buffer->session.load(std::memory_order_acquire) != session) {continue;}
+        //the events below the count are complete and never change during this capture
+        uint64_t count = buffer->count.load(std::memory_order_acquire);
+        dropped += buffer->dropped.load(std::memory_order_relaxed);
+        for (uint64_t i = 0; i < count; ++i)
+        {
+            const TraceEvent& event = buffer->events[i];
+            //the timestamps are microseconds since the start of the capture
+            double ts = (event.ticks > state.startTicks) ? (double)clock_TicksToNanoseconds(event.ticks - state.startTicks) / 1000. : 0.;
+            fputs(first ? "\n{\"name\":" : ",\n{\"name\":", file);
+            first = false;
+            __traceJsonString(file, event.name);
+            switch (event.type)
+            {
+            case GLGE_TRACE_EVENT_COMPLETE:
+                fprintf(file, ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f", ts, (double)clock_TicksToNanoseconds(event.duration) / 1000.);
+                break;
+            case GLGE_TRACE_EVENT_INSTANT:
+                fprintf(file, ",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f", ts);
+                break;
+            default:
+                fprintf(file, ",\"ph\":\"C\",\"ts\":%.3f,\"args\":{\"value\":%.17g}", ts, event.value);
+                break;
+            }
+            fprintf(file, ",\"pid\":%d,\"tid\":%llu}", pid, (unsigned long long)buffer->threadId);
+        }
+    }
+    fprintf(file, "\n],\"otherData\":{\"droppedEvents\":%llu}}\n", (unsigned long long)dropped);
+    return fclose(file) == 0;
+}
+
+}
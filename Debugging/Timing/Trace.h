@@ -0,0 +1,116 @@
+/**
+ * @file Trace.h
+ * @author DM8AT
+ * @brief define the recording of timed scopes, instant events and counters into per-thread buffers and their export as Chrome trace
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_BG_TRACE_
+#define _GLGE_BG_TRACE_
+
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+//the events are time stamped in clock ticks
+#include "Clock.h"
+
+/**
+ * @brief the amount of events each thread can record per capture if none is specified
+ */
+#define GLGE_TRACE_DEFAULT_EVENTS_PER_THREAD 65536
+
+/**
+ * @brief store the options of a trace capture. Zero-initialized members use their default.
+ */
+typedef struct s_TraceCreateInfo {
+    /**
+     * @brief the maximum amount of events each thread records. Further events are dropped and counted.
+     * 0 means GLGE_TRACE_DEFAULT_EVENTS_PER_THREAD.
+     */
+    uint64_t eventsPerThread;
+} TraceCreateInfo;
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief start a new capture. Events of a previous capture are discarded.
+ * 
+ * @param info the options of the capture or NULL to use the defaults
+ */
+void trace_Start(const TraceCreateInfo* info);
+
+/**
+ * @brief stop the current capture. The recorded events are kept till they are exported or a new capture starts.
+ */
+void trace_Stop();
+
+/**
+ * @brief check if a capture is running
+ * 
+ * @return true : events are recorded
+ * @return false : events are ignored
+ */
+bool trace_IsRecording();
+
+/**
+ * @brief record a timed scope of the calling thread. Ignored if no capture is running.
+ * 
+ * Each thread writes into its own buffer without locks. The name is stored as pointer and must stay valid till the
+ * capture is exported, e.g. a string literal.
+ * 
+ * @param name the name of the scope
+ * @param start the start of the scope in clock ticks
+ * @param duration the duration of the scope in clock ticks
+ */
+void trace_Complete(const char* name, uint64_t start, uint64_t duration);
+
+/**
+ * @brief record an instant event of the calling thread. Ignored if no capture is running.
+ * 
+ * @param name the name of the event. Must stay valid till the capture is exported.
+ */
+void trace_Instant(const char* name);
+
+/**
+ * @brief record the value of a counter. Ignored if no capture is running.
+ * 
+ * @param name the name of the counter. Must stay valid till the capture is exported.
+ * @param value the current value of the counter
+ */
+void trace_Counter(const char* name, double value);
+
+/**
+ * @brief get the amount of events that were dropped in the current or last capture because a thread's buffer was full
+ * 
+ * @return uint64_t the amount of dropped events
+ */
+uint64_t trace_DroppedCount();
+
+/**
+ * @brief write the events of the current or last capture as Chrome Trace Event JSON, loadable by chrome://tracing and Perfetto
+ * 
+ * The capture can keep running, only the events recorded so far are written.
+ * 
+ * @param path the path of the file to create
+ * @return true : the file was written
+ * @return false : the file could not be created
+ */
+bool trace_Export(const char* path);
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+#endif
@@ -17,6 +17,8 @@
 #include "CBinding/CBinding.h"
 //include the system info
 #include "SystemInfo/SystemInfo.h"
+//include threading stuff
+#include "Threading/Threading.h"
 //include logging stuff
 #include "Debugging/Logging/Logging.h"
 //include timing stuff
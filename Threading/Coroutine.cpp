@@ -0,0 +1,193 @@
+/**
+ * @file Coroutine.cpp
+ * @author DM8AT
+ * @brief implement the coroutine sleeping and the coroutine synchronisation primitives
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include coroutines
+#include "Coroutine.h"
+
+//only available with C++20 coroutines
+#if defined(__cpp_impl_coroutine)
+
+//the sleeping coroutines are ordered by their deadline
+#include <queue>
+#include <condition_variable>
+
+/**
+ * @brief a single thread that continues sleeping coroutines once their deadline is reached
+ */
+class CoroutineSleeper
+{
+public:
+
+    /**
+     * @brief Construct a new Coroutine Sleeper and start its thread
+     */
+    CoroutineSleeper()
+    {
+        //make sure the shared pool is created first, so it is destroyed after the sleeper
+        s_ThreadPool::shared();
+        m_thread = new Thread(threadMain, this);
+    }
+
+    /**
+     * @brief Destroy the Coroutine Sleeper. Coroutines that still sleep are never continued.
+     */
+    ~CoroutineSleeper()
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            m_stop = true;
+        }
+        m_cond.notify_one();
+        delete m_thread;
+    }
+
+    /**
+     * @brief add a sleeping coroutine
+     * 
+     * @param deadline the point in time to continue the coroutine at
+     * @param handle the coroutine
+     * @param pool the pool to continue the coroutine on
+     */
+    void add(std::chrono::steady_clock::time_point deadline, std::coroutine_handle<> handle, s_ThreadPool* pool)
+    {
+        bool earliest;
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            m_sleeping.push(Sleeping{deadline, handle, pool});
+            earliest = m_sleeping.top().handle == handle;
+        }
+        //only wake the thread if it has to wait for a shorter time now
+        if (earliest) {m_cond.notify_one();}
+    }
+
+    /**
+     * @brief get the sleeper shared by all coroutines
+     * 
+     * @return CoroutineSleeper& a reference to the sleeper
+     */
+    static CoroutineSleeper& shared()
+    {
+        static CoroutineSleeper sleeper;
+        return sleeper;
+    }
+
+protected:
+
+    /**
+     * @brief store a single sleeping coroutine
+     */
+    struct Sleeping
+    {
+        std::chrono::steady_clock::time_point deadline;
+        std::coroutine_handle<> handle;
+        s_ThreadPool* pool;
+
+        //the priority queue puts the largest element first, so order by the latest deadline
+        bool operator<(const Sleeping& other) const noexcept {return deadline > other.deadline;}
+    };
+
+    /**
+     * @brief the function of the sleeper thread
+     * 
+     * @param data a pointer to the sleeper
+     */
+    static void threadMain(void* data)
+    {
+        CoroutineSleeper* sleeper = (CoroutineSleeper*)data;
+        std::unique_lock<std::mutex> lock(sleeper->m_mutex);
+        while (!sleeper->m_stop)
+        {
+            if (sleeper->m_sleeping.empty()) {sleeper->m_cond.wait(lock); continue;}
+
+            //continue all coroutines that reached their deadline
+            Sleeping next = sleeper->m_sleeping.top();
+            if (next.deadline > std::chrono::steady_clock::now()) {sleeper->m_cond.wait_until(lock, next.deadline); continue;}
+            sleeper->m_sleeping.pop();
+            next.pool->submit(coroutine_Resume, next.handle.address());
+        }
+    }
+
+    /**
+     * @brief the thread that waits for the deadlines
+     */
+    Thread* m_thread = nullptr;
+    /**
+     * @brief protects the sleeping coroutines
+     */
+    std::mutex m_mutex;
+    /**
+     * @brief wakes the thread if a new earliest deadline was added or the sleeper stops
+     */
+    std::condition_variable m_cond;
+    /**
+     * @brief the sleeping coroutines, the earliest deadline first
+     */
+    std::priority_queue<Sleeping> m_sleeping;
+    /**
+     * @brief true if the thread should stop
+     */
+    bool m_stop = false;
+};
+
+void coroutine_ScheduleAt(std::chrono::steady_clock::time_point deadline, std::coroutine_handle<> handle, s_ThreadPool* pool)
+{CoroutineSleeper::shared().add(deadline, handle, pool);}
+
+bool AsyncMutex::try_lock() noexcept
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (m_locked) {return false;}
+    m_locked = true;
+    return true;
+}
+
+bool AsyncMutex::enqueue(std::coroutine_handle<> handle, s_ThreadPool* pool)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    //the mutex may have been unlocked since the try in await_ready
+    if (!m_locked) {m_locked = true; return false;}
+    m_waiters.push_back(Waiter{handle, pool});
+    return true;
+}
+
+void AsyncMutex::unlock()
+{
+    Waiter next;
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        if (m_waiters.empty()) {m_locked = false; return;}
+        //hand the ownership directly to the next waiter, the mutex stays locked
+        next = m_waiters.front();
+        m_waiters.pop_front();
+    }
+    //continue the new owner on its pool, so unlocking never runs foreign code
+    next.pool->submit(coroutine_Resume, next.handle.address());
+}
+
+void AsyncEvent::set()
+{
+    std::vector<Waiter> waiters;
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_set.store(true, std::memory_order_release);
+        waiters.swap(m_waiters);
+    }
+    for (const Waiter& waiter : waiters) {waiter.pool->submit(coroutine_Resume, waiter.handle.address());}
+}
+
+bool AsyncEvent::enqueue(std::coroutine_handle<> handle, s_ThreadPool* pool)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (m_set.load(std::memory_order_relaxed)) {return false;}
+    m_waiters.push_back(Waiter{handle, pool});
+    return true;
+}
+
+#endif
@@ -0,0 +1,650 @@
+/**
+ * @file Coroutine.h
+ * @author DM8AT
+ * @brief define C++20 coroutine tasks that run on a thread pool
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_BG_COROUTINE_
+#define _GLGE_BG_COROUTINE_
+
+//coroutines are resumed on the thread pool
+#include "ThreadPool.h"
+
+//coroutines only exist in C++20, there is no C binding
+#if __cplusplus && defined(__cpp_impl_coroutine)
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+#include <vector>
+#include <deque>
+#include <chrono>
+#include <atomic>
+#include <mutex>
+#include <semaphore>
+#include <type_traits>
+
+//the result of tasks is defined later
+template <typename T = void> class Task;
+
+/**
+ * @brief resume a coroutine from a thread pool task
+ * 
+ * @param handle the address of the coroutine handle to resume
+ */
+inline void coroutine_Resume(void* handle) {std::coroutine_handle<>::from_address(handle).resume();}
+
+/**
+ * @brief the part of the promise of a task that does not depend on the result type
+ */
+struct TaskPromiseBase
+{
+    /**
+     * @brief resume the awaiting coroutine once the task finished
+     */
+    struct FinalAwaiter
+    {
+        bool await_ready() const noexcept {return false;}
+        template <typename P>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<P> handle) noexcept {return handle.promise().m_continuation;}
+        void await_resume() noexcept {}
+    };
+
+    /**
+     * @brief tasks are lazy, they only start once they are awaited
+     */
+    std::suspend_always initial_suspend() noexcept {return {};}
+
+    /**
+     * @brief continue with the awaiting coroutine without growing the stack
+     */
+    FinalAwaiter final_suspend() noexcept {return {};}
+
+    /**
+     * @brief store an escaping exception, it is thrown again at the awaiting coroutine
+     */
+    void unhandled_exception() noexcept {m_exception = std::current_exception();}
+
+    /**
+     * @brief the coroutine that waits for this task
+     */
+    std::coroutine_handle<> m_continuation = std::noop_coroutine();
+    /**
+     * @brief the exception that escaped the task, if any
+     */
+    std::exception_ptr m_exception;
+};
+
+/**
+ * @brief the promise of a task that produces a value
+ * 
+ * @tparam T the type of the value
+ */
+template <typename T>
+struct TaskPromise : public TaskPromiseBase
+{
+    Task<T> get_return_object() noexcept;
+
+    template <typename U>
+    void return_value(U&& value) {m_value.emplace(std::forward<U>(value));}
+
+    /**
+     * @brief get the result or throw the exception of the task
+     * 
+     * @return T the result of the task
+     */
+    T result()
+    {
+        if (m_exception) {std::rethrow_exception(m_exception);}
+        return std::move(*m_value);
+    }
+
+    /**
+     * @brief the result of the task
+     */
+    std::optional<T> m_value;
+};
+
+/**
+ * @brief the promise of a task without a value
+ */
+template <>
+struct TaskPromise<void> : public TaskPromiseBase
+{
+    Task<void> get_return_object() noexcept;
+
+    void return_void() noexcept {}
+
+    /**
+     * @brief throw the exception of the task, if any
+     */
+    void result() {if (m_exception) {std::rethrow_exception(m_exception);}}
+};
+
+/**
+ * @brief store a lazily started coroutine that produces a value of type T
+ * 
+ * A task starts once it is awaited (or passed to syncWait / coroutine_Spawn) and runs on the thread that started it
+ * till it awaits something. Use co_await resumeOn(pool) to move it to a thread pool. Exceptions are passed to the awaiter.
+ * 
+ * @tparam T the type of the result. Must not be a reference.
+ */
+template <typename T>
+class Task
+{
+public:
+
+    using promise_type = TaskPromise<T>;
+
+    /**
+     * @brief Construct a new, empty Task
+     */
+    Task() noexcept = default;
+
+    /**
+     * @brief Construct a new Task from its coroutine
+     * 
+     * @param handle the handle of the coroutine
+     */
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept : m_handle(handle) {}
+
+    //tasks can only be moved
+    Task(Task&& other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other) {if (m_handle) {m_handle.destroy();} m_handle = std::exchange(other.m_handle, nullptr);}
+        return *this;
+    }
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    /**
+     * @brief Destroy the Task and its coroutine. A started task must have finished.
+     */
+    ~Task() {if (m_handle) {m_handle.destroy();}}
+
+    /**
+     * @brief check if the task finished
+     * 
+     * @return true : the task finished or is empty
+     * @return false : the task did not finish yet
+     */
+    inline bool done() const noexcept {return !m_handle || m_handle.done();}
+
+    /**
+     * @brief start the task and wait for its result
+     */
+    auto operator co_await() noexcept
+    {
+        struct Awaiter
+        {
+            std::coroutine_handle<promise_type> handle;
+            bool await_ready() const noexcept {return !handle || handle.done();}
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+            {
+                //continue with the task directly, it resumes the awaiting coroutine once it finished
+                handle.promise().m_continuation = awaiting;
+                return handle;
+            }
+            T await_resume() {return handle.promise().result();}
+        };
+        return Awaiter{m_handle};
+    }
+
+protected:
+
+    /**
+     * @brief the coroutine of the task
+     */
+    std::coroutine_handle<promise_type> m_handle = nullptr;
+};
+
+template <typename T>
+inline Task<T> TaskPromise<T>::get_return_object() noexcept {return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));}
+
+inline Task<void> TaskPromise<void>::get_return_object() noexcept {return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));}
+
+/**
+ * @brief a coroutine that starts instantly and destroys itself once it finished. Used for fire and forget tasks.
+ */
+struct DetachedTask
+{
+    struct promise_type
+    {
+        DetachedTask get_return_object() noexcept {return {};}
+        std::suspend_never initial_suspend() noexcept {return {};}
+        std::suspend_never final_suspend() noexcept {return {};}
+        void return_void() noexcept {}
+        //a detached task has no one to report an error to
+        void unhandled_exception() noexcept {std::terminate();}
+    };
+};
+
+/**
+ * @brief suspend the coroutine and continue it on a worker of a thread pool
+ */
+struct ResumeOnAwaiter
+{
+    /**
+     * @brief the pool to continue on
+     */
+    s_ThreadPool* pool;
+
+    bool await_ready() const noexcept {return false;}
+    void await_suspend(std::coroutine_handle<> handle) noexcept {pool->submit(coroutine_Resume, handle.address());}
+    void await_resume() noexcept {}
+};
+
+/**
+ * @brief continue the awaiting coroutine on a worker of a thread pool. Also usable to yield to other tasks.
+ * 
+ * @param pool the pool to continue on or NULL for the shared thread pool
+ * @return ResumeOnAwaiter the awaitable
+ */
+inline ResumeOnAwaiter resumeOn(s_ThreadPool* pool = nullptr) noexcept {return ResumeOnAwaiter{pool ? pool : &s_ThreadPool::shared()};}
+
+/**
+ * @brief schedule a coroutine to be continued on a thread pool once a point in time is reached
+ * 
+ * @param deadline the point in time to continue at
+ * @param handle the coroutine to continue
+ * @param pool the pool to continue on
+ */
+void coroutine_ScheduleAt(std::chrono::steady_clock::time_point deadline, std::coroutine_handle<> handle, s_ThreadPool* pool);
+
+/**
+ * @brief suspend the coroutine till a point in time is reached without blocking a thread
+ */
+struct SleepAwaiter
+{
+    /**
+     * @brief the point in time to continue at
+     */
+    std::chrono::steady_clock::time_point deadline;
+    /**
+     * @brief the pool to continue on
+     */
+    s_ThreadPool* pool;
+
+    bool await_ready() const noexcept {return deadline <= std::chrono::steady_clock::now();}
+    void await_suspend(std::coroutine_handle<> handle) {coroutine_ScheduleAt(deadline, handle, pool);}
+    void await_resume() noexcept {}
+};
+
+/**
+ * @brief suspend the awaiting coroutine for some time. No thread is blocked while sleeping.
+ * 
+ * @param duration the time to sleep
+ * @param pool the pool to continue on or NULL for the shared thread pool
+ * @return SleepAwaiter the awaitable
+ */
+template <typename Rep, typename Period>
+inline SleepAwaiter sleepFor(std::chrono::duration<Rep, Period> duration, s_ThreadPool* pool = nullptr)
+{
+    return SleepAwaiter{std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(duration),
+                        pool ? pool : &s_ThreadPool::shared()};
+}
+
+/**
+ * @brief store a mutex for coroutines. Waiting for the mutex suspends the coroutine instead of blocking the thread.
+ * 
+ * Ownership is handed directly to the next waiting coroutine on unlock. The new owner is continued on a thread pool.
+ */
+class AsyncMutex
+{
+public:
+
+    /**
+     * @brief suspend the coroutine till the mutex is locked
+     */
+    struct LockAwaiter
+    {
+        AsyncMutex& mutex;
+        s_ThreadPool* pool;
+
+        bool await_ready() noexcept {return mutex.try_lock();}
+        bool await_suspend(std::coroutine_handle<> handle) {return mutex.enqueue(handle, pool);}
+        void await_resume() noexcept {}
+    };
+
+    /**
+     * @brief unlock a mutex once it goes out of scope
+     */
+    struct Guard
+    {
+        Guard(AsyncMutex* mutex) noexcept : m_mutex(mutex) {}
+        Guard(Guard&& other) noexcept : m_mutex(std::exchange(other.m_mutex, nullptr)) {}
+        Guard(const Guard&) = delete;
+        ~Guard() {if (m_mutex) {m_mutex->unlock();}}
+    protected:
+        AsyncMutex* m_mutex;
+    };
+
+    /**
+     * @brief suspend the coroutine till the mutex is locked and return a guard that unlocks it
+     */
+    struct ScopedLockAwaiter : public LockAwaiter
+    {
+        Guard await_resume() noexcept {return Guard(&mutex);}
+    };
+
+    /**
+     * @brief lock the mutex. Use as co_await mutex.lock().
+     * 
+     * @param pool the pool to continue on if the coroutine had to wait or NULL for the shared thread pool
+     * @return LockAwaiter the awaitable
+     */
+    inline LockAwaiter lock(s_ThreadPool* pool = nullptr) noexcept {return LockAwaiter{*this, pool ? pool : &s_ThreadPool::shared()};}
+
+    /**
+     * @brief lock the mutex and get a guard that unlocks it. Use as auto guard = co_await mutex.scopedLock().
+     * 
+     * @param pool the pool to continue on if the coroutine had to wait or NULL for the shared thread pool
+     * @return ScopedLockAwaiter the awaitable
+     */
+    inline ScopedLockAwaiter scopedLock(s_ThreadPool* pool = nullptr) noexcept {return ScopedLockAwaiter{{*this, pool ? pool : &s_ThreadPool::shared()}};}
+
+    /**
+     * @brief try to lock the mutex without waiting
+     * 
+     * @return true : the mutex was locked
+     * @return false : the mutex is already locked
+     */
+    bool try_lock() noexcept;
+
+    /**
+     * @brief unlock the mutex. If a coroutine waits, it becomes the owner and is continued on its thread pool.
+     */
+    void unlock();
+
+protected:
+
+    /**
+     * @brief lock the mutex or add a coroutine to the waiters
+     * 
+     * @param handle the waiting coroutine
+     * @param pool the pool to continue the coroutine on
+     * @return true : the coroutine waits
+     * @return false : the mutex was locked, the coroutine continues directly
+     */
+    bool enqueue(std::coroutine_handle<> handle, s_ThreadPool* pool);
+
+    /**
+     * @brief store a single waiting coroutine
+     */
+    struct Waiter
+    {
+        std::coroutine_handle<> handle;
+        s_ThreadPool* pool;
+    };
+
+    /**
+     * @brief protects the state of the mutex
+     */
+    std::mutex m_mutex;
+    /**
+     * @brief true if a coroutine owns the mutex
+     */
+    bool m_locked = false;
+    /**
+     * @brief the waiting coroutines in the order they arrived
+     */
+    std::deque<Waiter> m_waiters;
+};
+
+/**
+ * @brief store an event coroutines can wait for. Once set, all waiting coroutines continue on their thread pool.
+ */
+class AsyncEvent
+{
+public:
+
+    /**
+     * @brief suspend the coroutine till the event is set
+     */
+    struct Awaiter
+    {
+        AsyncEvent& event;
+        s_ThreadPool* pool;
+
+        bool await_ready() const noexcept {return event.isSet();}
+        bool await_suspend(std::coroutine_handle<> handle) {return event.enqueue(handle, pool);}
+        void await_resume() noexcept {}
+    };
+
+    /**
+     * @brief Construct a new Async Event
+     * 
+     * @param set true to create the event in the set state
+     */
+    AsyncEvent(bool set = false) noexcept : m_set(set) {}
+
+    /**
+     * @brief wait for the event. Use as co_await event.wait().
+     * 
+     * @param pool the pool to continue on if the coroutine had to wait or NULL for the shared thread pool
+     * @return Awaiter the awaitable
+     */
+    inline Awaiter wait(s_ThreadPool* pool = nullptr) noexcept {return Awaiter{*this, pool ? pool : &s_ThreadPool::shared()};}
+
+    /**
+     * @brief wait for the event and continue on the shared thread pool
+     */
+    inline Awaiter operator co_await() noexcept {return wait();}
+
+    /**
+     * @brief set the event and continue all waiting coroutines. The event must stay alive till set returned.
+     */
+    void set();
+
+    /**
+     * @brief reset the event, so coroutines wait for it again
+     */
+    inline void reset() noexcept {m_set.store(false, std::memory_order_release);}
+
+    /**
+     * @brief check if the event is set
+     * 
+     * @return true : the event is set
+     * @return false : the event is not set
+     */
+    inline bool isSet() const noexcept {return m_set.load(std::memory_order_acquire);}
+
+protected:
+
+    /**
+     * @brief add a coroutine to the waiters if the event is not set
+     * 
+     * @param handle the waiting coroutine
+     * @param pool the pool to continue the coroutine on
+     * @return true : the coroutine waits
+     * @return false : the event is set, the coroutine continues directly
+     */
+    bool enqueue(std::coroutine_handle<> handle, s_ThreadPool* pool);
+
+    /**
+     * @brief store a single waiting coroutine
+     */
+    struct Waiter
+    {
+        std::coroutine_handle<> handle;
+        s_ThreadPool* pool;
+    };
+
+    /**
+     * @brief true if the event is set
+     */
+    std::atomic<bool> m_set;
+    /**
+     * @brief protects the waiters
+     */
+    std::mutex m_mutex;
+    /**
+     * @brief the waiting coroutines
+     */
+    std::vector<Waiter> m_waiters;
+};
+
+/**
+ * @brief run a task on a thread pool without waiting for it. An exception escaping the task terminates the program.
+ * 
+ * @param task the task to run
+ * @param pool the pool to start the task on or NULL for the shared thread pool
+ */
+inline DetachedTask coroutine_Spawn(Task<void> task, s_ThreadPool* pool = nullptr)
+{
+    co_await resumeOn(pool);
+    co_await task;
+}
+
+/**
+ * @brief store the shared state of a whenAll call
+ */
+struct WhenAllState
+{
+    /**
+     * @brief the amount of unfinished tasks plus one for the awaiting coroutine
+     */
+    std::atomic<size_t> remaining;
+    /**
+     * @brief the coroutine that waits for all tasks
+     */
+    std::coroutine_handle<> continuation;
+    /**
+     * @brief the first exception that escaped a task
+     */
+    std::exception_ptr exception;
+    /**
+     * @brief protects the exception
+     */
+    std::mutex mutex;
+
+    /**
+     * @brief mark a task as finished. The last one continues the awaiting coroutine.
+     */
+    void arrive() noexcept {if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {continuation.resume();}}
+
+    bool await_ready() const noexcept {return false;}
+    bool await_suspend(std::coroutine_handle<> handle) noexcept
+    {
+        continuation = handle;
+        //if all tasks already finished, continue directly
+        return remaining.fetch_sub(1, std::memory_order_acq_rel) != 1;
+    }
+    void await_resume() {if (exception) {std::rethrow_exception(exception);}}
+};
+
+/**
+ * @brief run a single task of a whenAll call
+ * 
+ * @param task the task to run
+ * @param state the shared state of the call
+ * @param pool the pool to run the task on
+ */
+inline DetachedTask coroutine_WhenAllRun(Task<void>& task, WhenAllState& state, s_ThreadPool* pool)
+{
+    co_await resumeOn(pool);
+    try {co_await task;}
+    catch (...)
+    {
+        std::lock_guard<std::mutex> guard(state.mutex);
+        if (!state.exception) {state.exception = std::current_exception();}
+    }
+    state.arrive();
+}
+
+/**
+ * @brief run tasks concurrently on a thread pool and wait till all of them finished
+ * 
+ * @param tasks the tasks to run
+ * @param pool the pool to run the tasks on or NULL for the shared thread pool
+ * @return Task<void> a task that finishes once all tasks finished. It throws the first exception of the tasks.
+ */
+inline Task<void> whenAll(std::vector<Task<void>> tasks, s_ThreadPool* pool = nullptr)
+{
+    WhenAllState state{};
+    state.remaining.store(tasks.size() + 1, std::memory_order_relaxed);
+    for (Task<void>& task : tasks) {coroutine_WhenAllRun(task, state, pool);}
+    co_await state;
+}
+
+/**
+ * @brief a coroutine that signals a semaphore once it finished, used to block on a task
+ */
+struct SyncWaitTask
+{
+    struct promise_type
+    {
+        struct FinalAwaiter
+        {
+            bool await_ready() const noexcept {return false;}
+            void await_suspend(std::coroutine_handle<promise_type> handle) noexcept {handle.promise().done->release();}
+            void await_resume() noexcept {}
+        };
+
+        SyncWaitTask get_return_object() noexcept {return SyncWaitTask{std::coroutine_handle<promise_type>::from_promise(*this)};}
+        std::suspend_always initial_suspend() noexcept {return {};}
+        FinalAwaiter final_suspend() noexcept {return {};}
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept {exception = std::current_exception();}
+
+        std::binary_semaphore* done = nullptr;
+        std::exception_ptr exception;
+    };
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+/**
+ * @brief run a task and store its result
+ * 
+ * @tparam T the type of the result
+ * @param task the task to run
+ * @param result the storage for the result
+ */
+template <typename T>
+inline SyncWaitTask coroutine_SyncWaitRun(Task<T>& task, std::optional<T>& result) {result.emplace(co_await task);}
+
+/**
+ * @brief run a task without a result
+ * 
+ * @param task the task to run
+ */
+inline SyncWaitTask coroutine_SyncWaitRun(Task<void>& task) {co_await task;}
+
+/**
+ * @brief start a task on the calling thread and block till it finished. Must not be called from a coroutine.
+ * 
+ * @tparam T the type of the result
+ * @param task the task to run
+ * @return T the result of the task. Exceptions of the task are thrown again.
+ */
+template <typename T>
+inline T syncWait(Task<T> task)
+{
+    std::binary_semaphore done(0);
+    std::optional<std::conditional_t<std::is_void_v<T>, char, T>> result;
+    SyncWaitTask run;
+    if constexpr (std::is_void_v<T>) {run = coroutine_SyncWaitRun(task);}
+    else {run = coroutine_SyncWaitRun(task, result);}
+
+    run.handle.promise().done = &done;
+    run.handle.resume();
+    done.acquire();
+
+    std::exception_ptr exception = run.handle.promise().exception;
+    run.handle.destroy();
+    if (exception) {std::rethrow_exception(exception);}
+    if constexpr (!std::is_void_v<T>) {return std::move(*result);}
+}
+
+#endif
+
+#endif
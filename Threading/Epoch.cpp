@@ -0,0 +1,138 @@
+/**
+ * @file Epoch.cpp
+ * @author DM8AT
+ * @brief implement the epoch based memory reclamation
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include epochs
+#include "Epoch.h"
+
+//yield while waiting for readers
+#include <thread>
+//find participants in the domain
+#include <algorithm>
+
+s_EpochDomain::~s_EpochDomain()
+{
+    //no reader can exist anymore, so everything can be destroyed
+    for (const EpochRetired& retired : m_orphans) {(*retired.destroy)(retired.ptr);}
+}
+
+bool s_EpochDomain::tryAdvance() noexcept
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+
+    //all participants in a critical section must have seen the current epoch
+    uint64_t epoch = m_epoch.load(std::memory_order_seq_cst);
+    for (s_EpochParticipant* participant : m_participants)
+    {
+        uint64_t local = participant->m_local.load(std::memory_order_seq_cst);
+        if ((local & 1) && ((local >> 1) != epoch)) {return false;}
+    }
+
+    //only advancing happens under the mutex, so a plain store is fine
+    m_epoch.store(epoch + 1, std::memory_order_seq_cst);
+    //the orphans have no owner that flushes them
+    reclaim(m_orphans, epoch + 1);
+    return true;
+}
+
+void s_EpochDomain::synchronize() noexcept
+{
+    //everything retired till now was retired in an epoch <= the current one, so two advances are needed
+    uint64_t target = m_epoch.load(std::memory_order_seq_cst) + 2;
+    while (m_epoch.load(std::memory_order_acquire) < target)
+    {
+        if (!tryAdvance()) {std::this_thread::yield();}
+    }
+}
+
+void s_EpochDomain::reclaim(std::vector<EpochRetired>& list, uint64_t epoch) noexcept
+{
+    //the list is ordered by the epoch, so only a prefix can be destroyed
+    size_t count = 0;
+    while ((count < list.size()) && (list[count].epoch + 2 <= epoch))
+    {
+        (*list[count].destroy)(list[count].ptr);
+        ++count;
+    }
+    list.erase(list.begin(), list.begin() + count);
+}
+
+s_EpochParticipant::s_EpochParticipant(s_EpochDomain& domain)
+ : m_domain(&domain)
+{
+    m_limbo.reserve(domain.batchSize());
+    std::lock_guard<std::mutex> guard(domain.m_mutex);
+    domain.m_participants.push_back(this);
+}
+
+s_EpochParticipant::~s_EpochParticipant()
+{
+    std::lock_guard<std::mutex> guard(m_domain->m_mutex);
+    //unregister and hand over everything that is still retired
+    auto it = std::find(m_domain->m_participants.begin(), m_domain->m_participants.end(), this);
+    if (it != m_domain->m_participants.end()) {m_domain->m_participants.erase(it);}
+    m_domain->m_orphans.insert(m_domain->m_orphans.end(), m_limbo.begin(), m_limbo.end());
+}
+
+void s_EpochParticipant::announce() noexcept
+{
+    //the announcement must be visible before any shared pointer is read. If the epoch changed in between, 
+    //announce again so the participant does not hold the epoch back.
+    uint64_t epoch = m_domain->m_epoch.load(std::memory_order_seq_cst);
+    while (true)
+    {
+        m_local.store((epoch << 1) | 1, std::memory_order_seq_cst);
+        uint64_t current = m_domain->m_epoch.load(std::memory_order_seq_cst);
+        if (current == epoch) {return;}
+        epoch = current;
+    }
+}
+
+void s_EpochParticipant::retire(void* ptr, void (*destroy)(void*)) noexcept
+{
+    m_limbo.push_back(EpochRetired{ptr, destroy, m_domain->m_epoch.load(std::memory_order_seq_cst)});
+    //collect objects and destroy them in batches to keep the cost of advancing low
+    if (m_limbo.size() >= m_domain->batchSize()) {flush();}
+}
+
+void s_EpochParticipant::flush() noexcept
+{
+    m_domain->tryAdvance();
+    s_EpochDomain::reclaim(m_limbo, m_domain->epoch());
+}
+
+
+extern "C" {
+
+EpochDomain* epochDomain_Create(uint32_t batchSize) {return new EpochDomain(batchSize);}
+
+void epochDomain_Destroy(EpochDomain* domain) {delete domain;}
+
+bool epochDomain_TryAdvance(EpochDomain* domain) {return domain->tryAdvance();}
+
+void epochDomain_Synchronize(EpochDomain* domain) {domain->synchronize();}
+
+uint64_t epochDomain_Epoch(const EpochDomain* domain) {return domain->epoch();}
+
+EpochParticipant* epochParticipant_Create(EpochDomain* domain) {return new EpochParticipant(*domain);}
+
+void epochParticipant_Destroy(EpochParticipant* participant) {delete participant;}
+
+void epochParticipant_Enter(EpochParticipant* participant) {participant->enter();}
+
+void epochParticipant_Exit(EpochParticipant* participant) {participant->exit();}
+
+void epochParticipant_Retire(void* ptr, void (*destroy)(void*), EpochParticipant* participant) {participant->retire(ptr, destroy);}
+
+void epochParticipant_Flush(EpochParticipant* participant) {participant->flush();}
+
+uint64_t epochParticipant_PendingCount(const EpochParticipant* participant) {return participant->pendingCount();}
+
+}
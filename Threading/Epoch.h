@@ -0,0 +1,383 @@
+/**
+ * @file Epoch.h
+ * @author DM8AT
+ * @brief define epoch based memory reclamation for lock-free data structures
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_BG_EPOCH_
+#define _GLGE_BG_EPOCH_
+
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+//include atomics, mutexes and containers for C++
+#if __cplusplus
+#include <atomic>
+#include <mutex>
+#include <vector>
+#endif
+
+/**
+ * @brief store a single object that waits to be destroyed
+ */
+typedef struct s_EpochRetired {
+    /**
+     * @brief the object to destroy
+     */
+    void* ptr;
+    /**
+     * @brief the function that destroys the object
+     */
+    void (*destroy)(void*);
+    /**
+     * @brief the global epoch at the time the object was retired
+     */
+    uint64_t epoch;
+} EpochRetired;
+
+//the participants are defined after the domain
+#if __cplusplus
+struct s_EpochParticipant;
+#endif
+
+/**
+ * @brief store an epoch domain. A domain decides when retired objects can no longer be reached by any reader.
+ * 
+ * Readers access shared objects only inside of a critical section of their participant. Writers unlink an object from
+ * the shared structure and then retire it. The domain has a global epoch that only advances once every participant that
+ * is inside of a critical section has seen the current epoch. An object retired in epoch e can't be reached by any
+ * reader once the global epoch reached e + 2, so it is destroyed then.
+ */
+typedef struct s_EpochDomain {
+
+    //check for C++ to define the epoch domain
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new Epoch Domain
+     * 
+     * @param batchSize the amount of retired objects a participant collects before it tries to destroy them. 0 means 64.
+     */
+    s_EpochDomain(uint32_t batchSize = 0) noexcept : m_batchSize((batchSize == 0) ? 64 : batchSize) {}
+
+    /**
+     * @brief Destroy the Epoch Domain. All participants must be destroyed first. Destroys all objects that are still retired.
+     */
+    ~s_EpochDomain();
+
+    /**
+     * @brief try to advance the global epoch. Fails if a participant is still in a critical section of an older epoch.
+     * 
+     * @return true : the epoch was advanced
+     * @return false : the epoch could not be advanced
+     */
+    bool tryAdvance() noexcept;
+
+    /**
+     * @brief block till all objects that were retired before the call can be destroyed. Must not be called inside of a critical section.
+     * 
+     * This can be used to swap a shared object and destroy the old one directly afterwards, without retiring it.
+     */
+    void synchronize() noexcept;
+
+    /**
+     * @brief get the current global epoch
+     * 
+     * @return uint64_t the global epoch
+     */
+    inline uint64_t epoch() const noexcept {return m_epoch.load(std::memory_order_acquire);}
+
+    /**
+     * @brief get the amount of retired objects a participant collects before it tries to destroy them
+     * 
+     * @return uint32_t the batch size
+     */
+    inline uint32_t batchSize() const noexcept {return m_batchSize;}
+
+protected:
+
+    //participants register themselves and hand over their objects on destruction
+    friend struct s_EpochParticipant;
+
+    /**
+     * @brief destroy all objects of a list that were retired at least two epochs ago and remove them from the list
+     * 
+     * @param list the list to clean. It is ordered by the epoch.
+     * @param epoch the current global epoch
+     */
+    static void reclaim(std::vector<EpochRetired>& list, uint64_t epoch) noexcept;
+
+    /**
+     * @brief the global epoch
+     */
+    alignas(64) std::atomic<uint64_t> m_epoch{0};
+    /**
+     * @brief the amount of retired objects a participant collects before it tries to destroy them
+     */
+    uint32_t m_batchSize;
+    /**
+     * @brief protect the participant list and the orphans
+     */
+    std::mutex m_mutex;
+    /**
+     * @brief all registered participants
+     */
+    std::vector<struct s_EpochParticipant*> m_participants;
+    /**
+     * @brief retired objects of participants that were already destroyed
+     */
+    std::vector<EpochRetired> m_orphans;
+
+    #else
+
+    //for windows, add a single byte here to make the struct contain something
+    uint8_t byte;
+
+    #endif
+
+    //for C, this is an opaque structure
+
+} EpochDomain;
+
+/**
+ * @brief store a participant of an epoch domain. Every thread that reads or retires objects needs its own participant.
+ */
+typedef struct s_EpochParticipant {
+
+    //check for C++ to define the participant
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new Epoch Participant and register it at a domain
+     * 
+     * @param domain the domain to participate in
+     */
+    s_EpochParticipant(s_EpochDomain& domain);
+
+    /**
+     * @brief Destroy the Epoch Participant. Must not be inside of a critical section. Objects that are still retired are handed to the domain.
+     */
+    ~s_EpochParticipant();
+
+    /**
+     * @brief enter a critical section. Shared objects may only be read inside of a critical section. Critical sections can be nested.
+     */
+    inline void enter() noexcept {if (m_nesting++ == 0) {announce();}}
+
+    /**
+     * @brief leave a critical section. Pointers read inside of the critical section must not be used afterwards.
+     */
+    inline void exit() noexcept {if (--m_nesting == 0) {m_local.store(0, std::memory_order_release);}}
+
+    /**
+     * @brief check if the participant is inside of a critical section
+     * 
+     * @return true : the participant is inside of a critical section
+     * @return false : the participant is outside of all critical sections
+     */
+    inline bool inCriticalSection() const noexcept {return m_nesting != 0;}
+
+    /**
+     * @brief retire an object that was removed from a shared structure. It is destroyed once no reader can reach it anymore.
+     * 
+     * @param ptr the object to retire
+     * @param destroy the function to destroy the object with
+     */
+    void retire(void* ptr, void (*destroy)(void*)) noexcept;
+
+    /**
+     * @brief try to advance the epoch and destroy all retired objects that can no longer be reached
+     */
+    void flush() noexcept;
+
+    /**
+     * @brief get the amount of objects that are retired but not destroyed yet
+     * 
+     * @return uint64_t the amount of retired objects
+     */
+    inline uint64_t pendingCount() const noexcept {return m_limbo.size();}
+
+protected:
+
+    //the domain reads the announced epochs
+    friend struct s_EpochDomain;
+
+    /**
+     * @brief announce the current global epoch to the domain
+     */
+    void announce() noexcept;
+
+    /**
+     * @brief the announced epoch. 0 means outside of a critical section, else (epoch << 1) | 1.
+     */
+    alignas(64) std::atomic<uint64_t> m_local{0};
+    /**
+     * @brief the depth of nested critical sections
+     */
+    uint32_t m_nesting = 0;
+    /**
+     * @brief the domain the participant belongs to
+     */
+    s_EpochDomain* m_domain;
+    /**
+     * @brief the objects retired by this participant that are not destroyed yet, ordered by their epoch
+     */
+    std::vector<EpochRetired> m_limbo;
+
+    #else
+
+    //for windows, add a single byte here to make the struct contain something
+    uint8_t byte;
+
+    #endif
+
+    //for C, this is an opaque structure
+
+} EpochParticipant;
+
+//a scoped critical section for C++
+#if __cplusplus
+
+/**
+ * @brief enter a critical section of a participant for the lifetime of the guard
+ */
+struct EpochGuard
+{
+    /**
+     * @brief Construct a new Epoch Guard and enter the critical section
+     * 
+     * @param participant the participant to enter the critical section of
+     */
+    EpochGuard(s_EpochParticipant& participant) noexcept : m_participant(participant) {m_participant.enter();}
+
+    /**
+     * @brief Destroy the Epoch Guard and leave the critical section
+     */
+    ~EpochGuard() {m_participant.exit();}
+
+    //the guard can't be copied
+    EpochGuard(const EpochGuard&) = delete;
+    EpochGuard& operator=(const EpochGuard&) = delete;
+
+protected:
+
+    /**
+     * @brief the participant the critical section belongs to
+     */
+    s_EpochParticipant& m_participant;
+};
+
+#endif
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief create a new epoch domain
+ * 
+ * @param batchSize the amount of retired objects a participant collects before it tries to destroy them. 0 means 64.
+ * @return EpochDomain* a pointer to the new epoch domain
+ */
+EpochDomain* epochDomain_Create(uint32_t batchSize);
+
+/**
+ * @brief destroy an epoch domain. All participants must be destroyed first. Destroys all objects that are still retired.
+ * 
+ * @param domain a pointer to the epoch domain to destroy
+ */
+void epochDomain_Destroy(EpochDomain* domain);
+
+/**
+ * @brief try to advance the global epoch of a domain
+ * 
+ * @param domain a pointer to the epoch domain
+ * @return true : the epoch was advanced
+ * @return false : a participant is still in a critical section of an older epoch
+ */
+bool epochDomain_TryAdvance(EpochDomain* domain);
+
+/**
+ * @brief block till all objects that were retired before the call can be destroyed. Must not be called inside of a critical section.
+ * 
+ * @param domain a pointer to the epoch domain
+ */
+void epochDomain_Synchronize(EpochDomain* domain);
+
+/**
+ * @brief get the current global epoch of a domain
+ * 
+ * @param domain a pointer to the epoch domain to quarry
+ * @return uint64_t the global epoch
+ */
+uint64_t epochDomain_Epoch(const EpochDomain* domain);
+
+/**
+ * @brief create a new participant of an epoch domain. Each thread needs its own participant.
+ * 
+ * @param domain a pointer to the domain to participate in
+ * @return EpochParticipant* a pointer to the new participant
+ */
+EpochParticipant* epochParticipant_Create(EpochDomain* domain);
+
+/**
+ * @brief destroy a participant. Must not be inside of a critical section. Objects that are still retired are handed to the domain.
+ * 
+ * @param participant a pointer to the participant to destroy
+ */
+void epochParticipant_Destroy(EpochParticipant* participant);
+
+/**
+ * @brief enter a critical section. Shared objects may only be read inside of a critical section. Critical sections can be nested.
+ * 
+ * @param participant a pointer to the participant of the calling thread
+ */
+void epochParticipant_Enter(EpochParticipant* participant);
+
+/**
+ * @brief leave a critical section. Pointers read inside of the critical section must not be used afterwards.
+ * 
+ * @param participant a pointer to the participant of the calling thread
+ */
+void epochParticipant_Exit(EpochParticipant* participant);
+
+/**
+ * @brief retire an object that was removed from a shared structure. It is destroyed once no reader can reach it anymore.
+ * 
+ * @param ptr the object to retire
+ * @param destroy the function to destroy the object with, e.g. free
+ * @param participant a pointer to the participant of the calling thread
+ */
+void epochParticipant_Retire(void* ptr, void (*destroy)(void*), EpochParticipant* participant);
+
+/**
+ * @brief try to advance the epoch and destroy all retired objects of a participant that can no longer be reached
+ * 
+ * @param participant a pointer to the participant of the calling thread
+ */
+void epochParticipant_Flush(EpochParticipant* participant);
+
+/**
+ * @brief get the amount of objects of a participant that are retired but not destroyed yet
+ * 
+ * @param participant a pointer to the participant to quarry
+ * @return uint64_t the amount of retired objects
+ */
+uint64_t epochParticipant_PendingCount(const EpochParticipant* participant);
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+#endif
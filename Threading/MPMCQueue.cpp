@@ -0,0 +1,131 @@
+/**
+ * @file MPMCQueue.cpp
+ * @author DM8AT
+ * @brief implement the multi-producer / multi-consumer queue and its C binding
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the queue
+#include "MPMCQueue.h"
+
+//memory management stuff
+#include <cstring>
+#include <new>
+
+s_MPMCQueue::s_MPMCQueue(uint64_t elementSize, uint64_t capacity) noexcept
+ : m_elementSize(elementSize)
+{
+    //round the capacity up to the next power of two, the algorithm needs at least two slots
+    uint64_t cap = 2;
+    while (cap < capacity) {cap <<= 1;}
+    m_mask = cap - 1;
+
+    //each slot stores the sequence number followed by the element, aligned for the next sequence number
+    m_stride = sizeof(std::atomic<uint64_t>) + elementSize;
+    m_stride = (m_stride + alignof(std::atomic<uint64_t>) - 1) & ~(uint64_t)(alignof(std::atomic<uint64_t>) - 1);
+    m_data = new uint8_t[cap * m_stride];
+
+    //initially, every slot is ready for the producer of its own index
+    for (uint64_t i = 0; i < cap; ++i) {new (m_data + i * m_stride) std::atomic<uint64_t>(i);}
+}
+
+s_MPMCQueue::~s_MPMCQueue()
+{
+    delete[] m_data;
+}
+
+uint64_t s_MPMCQueue::pushBatch(const void* elements, uint64_t count) noexcept
+{
+    if (count == 0) {return 0;}
+
+    uint64_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+    while (true)
+    {
+        //count how many consecutive slots are free for this lap
+        uint64_t ready = 0;
+        while ((ready < count) && (sequence(pos + ready).load(std::memory_order_acquire) == pos + ready)) {++ready;}
+
+        if (ready == 0)
+        {
+            //the first slot is still in use by the previous lap: the queue is full
+            int64_t diff = (int64_t)(sequence(pos).load(std::memory_order_acquire) - pos);
+            if (diff < 0) {return 0;}
+            //another producer was faster, try again with the new position
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        //claim all free slots at once. On failure, pos is updated.
+        if (m_enqueuePos.compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed)) {count = ready; break;}
+    }
+
+    //copy the elements and publish each slot to the consumers
+    const uint8_t* src = (const uint8_t*)elements;
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        memcpy(element(pos + i), src + i * m_elementSize, m_elementSize);
+        sequence(pos + i).store(pos + i + 1, std::memory_order_release);
+    }
+    return count;
+}
+
+uint64_t s_MPMCQueue::popBatch(void* elements, uint64_t maxCount) noexcept
+{
+    if (maxCount == 0) {return 0;}
+
+    uint64_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+    uint64_t count = 0;
+    while (true)
+    {
+        //count how many consecutive slots are filled for this lap
+        uint64_t ready = 0;
+        while ((ready < maxCount) && (sequence(pos + ready).load(std::memory_order_acquire) == pos + ready + 1)) {++ready;}
+
+        if (ready == 0)
+        {
+            //the first slot was not written yet: the queue is empty
+            int64_t diff = (int64_t)(sequence(pos).load(std::memory_order_acquire) - (pos + 1));
+            if (diff < 0) {return 0;}
+            //another consumer was faster, try again with the new position
+            pos = m_dequeuePos.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        //claim all filled slots at once. On failure, pos is updated.
+        if (m_dequeuePos.compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed)) {count = ready; break;}
+    }
+
+    //copy the elements out and hand each slot to the producers of the next lap
+    uint8_t* dst = (uint8_t*)elements;
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        memcpy(dst + i * m_elementSize, element(pos + i), m_elementSize);
+        sequence(pos + i).store(pos + i + m_mask + 1, std::memory_order_release);
+    }
+    return count;
+}
+
+
+extern "C" {
+
+MPMCQueue* mpmcQueue_Create(uint64_t elementSize, uint64_t capacity) {return new MPMCQueue(elementSize, capacity);}
+
+void mpmcQueue_Destroy(MPMCQueue* queue) {delete queue;}
+
+bool mpmcQueue_Push(const void* element, MPMCQueue* queue) {return queue->push(element);}
+
+uint64_t mpmcQueue_PushBatch(const void* elements, uint64_t count, MPMCQueue* queue) {return queue->pushBatch(elements, count);}
+
+bool mpmcQueue_Pop(void* element, MPMCQueue* queue) {return queue->pop(element);}
+
+uint64_t mpmcQueue_PopBatch(void* elements, uint64_t maxCount, MPMCQueue* queue) {return queue->popBatch(elements, maxCount);}
+
+uint64_t mpmcQueue_Size(const MPMCQueue* queue) {return queue->size();}
+
+uint64_t mpmcQueue_Capacity(const MPMCQueue* queue) {return queue->capacity();}
+
+}
@@ -0,0 +1,264 @@
+/**
+ * @file MPMCQueue.h
+ * @author DM8AT
+ * @brief define a lock-free, bounded multi-producer / multi-consumer queue
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_BG_MPMC_QUEUE_
+#define _GLGE_BG_MPMC_QUEUE_
+
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+//the cache line size is shared with the single-producer / single-consumer queue
+#include "SPSCQueue.h"
+
+//include atomics for C++
+#if __cplusplus
+#include <atomic>
+#endif
+
+/**
+ * @brief store a bounded queue for any amount of producing and consuming threads
+ * 
+ * This is a Vyukov style queue: every slot stores a sequence number next to the element, which tells producers and
+ * consumers if the slot is ready for them in the current lap around the ring. Producers and consumers only contend on
+ * their own index. Like a vector, the queue stores elements of a fixed size that is given on creation. The capacity is
+ * rounded up to the next power of two.
+ */
+typedef struct s_MPMCQueue {
+
+    //check for C++ to define the queue
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new MPMC Queue
+     * 
+     * @param elementSize the size of a single element in bytes
+     * @param capacity the minimum amount of elements the queue can hold. At least 2.
+     */
+    s_MPMCQueue(uint64_t elementSize, uint64_t capacity) noexcept;
+
+    /**
+     * @brief Destroy the MPMC Queue
+     */
+    ~s_MPMCQueue();
+
+    /**
+     * @brief add an element to the queue
+     * 
+     * @param element a pointer to the element to copy into the queue
+     * @return true : the element was added
+     * @return false : the queue is full
+     */
+    inline bool push(const void* element) noexcept {return pushBatch(element, 1) == 1;}
+
+    /**
+     * @brief add multiple consecutive elements to the queue. The elements are claimed in a single step, so they stay in order.
+     * 
+     * @param elements a pointer to the tightly packed elements to copy into the queue
+     * @param count the amount of elements to add
+     * @return uint64_t the amount of elements that were added. Less than count if the queue ran full.
+     */
+    uint64_t pushBatch(const void* elements, uint64_t count) noexcept;
+
+    /**
+     * @brief remove the oldest element from the queue
+     * 
+     * @param element a pointer to the memory to copy the element to
+     * @return true : an element was removed
+     * @return false : the queue is empty
+     */
+    inline bool pop(void* element) noexcept {return popBatch(element, 1) == 1;}
+
+    /**
+     * @brief remove multiple consecutive elements from the queue
+     * 
+     * @param elements a pointer to the memory to copy the elements to. Must fit maxCount elements.
+     * @param maxCount the maximum amount of elements to remove
+     * @return uint64_t the amount of elements that were removed
+     */
+    uint64_t popBatch(void* elements, uint64_t maxCount) noexcept;
+
+    /**
+     * @brief get an estimation of the amount of queued elements
+     * 
+     * @return uint64_t the amount of queued elements at some point during the call
+     */
+    inline uint64_t size() const noexcept
+    {
+        //load the consumer index first, so the producer index is never behind it
+        uint64_t head = m_dequeuePos.load(std::memory_order_acquire);
+        uint64_t tail = m_enqueuePos.load(std::memory_order_acquire);
+        return (tail > head) ? (tail - head) : 0;
+    }
+
+    /**
+     * @brief get the maximum amount of elements in the queue
+     * 
+     * @return uint64_t the capacity of the queue
+     */
+    inline uint64_t capacity() const noexcept {return m_mask + 1;}
+
+    /**
+     * @brief get the size of a single element
+     * 
+     * @return uint64_t the size of a single element in bytes
+     */
+    inline uint64_t elementSize() const noexcept {return m_elementSize;}
+
+protected:
+
+    /**
+     * @brief get the sequence number of a slot
+     * 
+     * @param index the (unwrapped) index of the slot
+     * @return std::atomic<uint64_t>& a reference to the sequence number
+     */
+    inline std::atomic<uint64_t>& sequence(uint64_t index) const noexcept
+    {return *(std::atomic<uint64_t>*)(m_data + (index & m_mask) * m_stride);}
+
+    /**
+     * @brief get the element memory of a slot
+     * 
+     * @param index the (unwrapped) index of the slot
+     * @return uint8_t* a pointer to the element memory
+     */
+    inline uint8_t* element(uint64_t index) const noexcept
+    {return m_data + (index & m_mask) * m_stride + sizeof(std::atomic<uint64_t>);}
+
+    //read-only after construction
+
+    /**
+     * @brief the slot storage. Each slot is a sequence number followed by the element.
+     */
+    alignas(GLGE_QUEUE_CACHE_LINE) uint8_t* m_data = nullptr;
+    /**
+     * @brief the mask to wrap an index into the ring
+     */
+    uint64_t m_mask = 0;
+    /**
+     * @brief the size of a single element
+     */
+    uint64_t m_elementSize = 0;
+    /**
+     * @brief the distance between two slots in bytes
+     */
+    uint64_t m_stride = 0;
+
+    /**
+     * @brief the next index producers write to
+     */
+    alignas(GLGE_QUEUE_CACHE_LINE) std::atomic<uint64_t> m_enqueuePos{0};
+    /**
+     * @brief the next index consumers read from
+     */
+    alignas(GLGE_QUEUE_CACHE_LINE) std::atomic<uint64_t> m_dequeuePos{0};
+    /**
+     * @brief pad the end so the consumer index does not share a cache line with the next object
+     */
+    uint8_t m_pad[GLGE_QUEUE_CACHE_LINE - sizeof(std::atomic<uint64_t>)];
+
+    #else
+
+    //for windows, add a single byte here to make the struct contain something
+    uint8_t byte;
+
+    #endif
+
+    //for C, this is an opaque structure
+
+} MPMCQueue;
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief create a new multi-producer / multi-consumer queue
+ * 
+ * @param elementSize the size of a single element in bytes
+ * @param capacity the minimum amount of elements the queue can hold. Rounded up to a power of two, at least 2.
+ * @return MPMCQueue* a pointer to the new queue
+ */
+MPMCQueue* mpmcQueue_Create(uint64_t elementSize, uint64_t capacity);
+
+/**
+ * @brief destroy a multi-producer / multi-consumer queue
+ * 
+ * @param queue a pointer to the queue to destroy
+ */
+void mpmcQueue_Destroy(MPMCQueue* queue);
+
+/**
+ * @brief add an element to a queue
+ * 
+ * @param element a pointer to the element to copy into the queue
+ * @param queue a pointer to the queue to add the element to
+ * @return true : the element was added
+ * @return false : the queue is full
+ */
+bool mpmcQueue_Push(const void* element, MPMCQueue* queue);
+
+/**
+ * @brief add multiple consecutive elements to a queue
+ * 
+ * @param elements a pointer to the tightly packed elements to copy into the queue
+ * @param count the amount of elements to add
+ * @param queue a pointer to the queue to add the elements to
+ * @return uint64_t the amount of elements that were added
+ */
+uint64_t mpmcQueue_PushBatch(const void* elements, uint64_t count, MPMCQueue* queue);
+
+/**
+ * @brief remove the oldest element from a queue
+ * 
+ * @param element a pointer to the memory to copy the element to
+ * @param queue a pointer to the queue to remove the element from
+ * @return true : an element was removed
+ * @return false : the queue is empty
+ */
+bool mpmcQueue_Pop(void* element, MPMCQueue* queue);
+
+/**
+ * @brief remove multiple consecutive elements from a queue
+ * 
+ * @param elements a pointer to the memory to copy the elements to. Must fit maxCount elements.
+ * @param maxCount the maximum amount of elements to remove
+ * @param queue a pointer to the queue to remove the elements from
+ * @return uint64_t the amount of elements that were removed
+ */
+uint64_t mpmcQueue_PopBatch(void* elements, uint64_t maxCount, MPMCQueue* queue);
+
+/**
+ * @brief get an estimation of the amount of elements in a queue
+ * 
+ * @param queue a pointer to the queue to quarry
+ * @return uint64_t the amount of queued elements
+ */
+uint64_t mpmcQueue_Size(const MPMCQueue* queue);
+
+/**
+ * @brief get the maximum amount of elements in a queue
+ * 
+ * @param queue a pointer to the queue to quarry
+ * @return uint64_t the capacity of the queue
+ */
+uint64_t mpmcQueue_Capacity(const MPMCQueue* queue);
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+#endif
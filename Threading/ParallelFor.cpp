@@ -0,0 +1,232 @@
+/**
+ * @file ParallelFor.cpp
+ * @author DM8AT
+ * @brief implement the parallel loops and reductions
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include parallel loops
+#include "ParallelFor.h"
+
+//memory management stuff
+#include <cstring>
+
+bool s_ParallelRange::next(uint64_t& begin, uint64_t& end) noexcept
+{
+    uint64_t cur = m_next.load(std::memory_order_relaxed);
+    while (cur < m_end)
+    {
+        //hand out half of the fair share of the remaining work, but at least a single grain
+        uint64_t remaining = m_end - cur;
+        uint64_t chunk = remaining / (2 * (uint64_t)m_participants);
+        chunk = (chunk < m_grain) ? m_grain : chunk;
+        chunk = (chunk > remaining) ? remaining : chunk;
+        //try to claim the chunk. On failure, cur is updated and the chunk is re-calculated.
+        if (m_next.compare_exchange_weak(cur, cur + chunk, std::memory_order_relaxed))
+        {
+            begin = cur;
+            end = cur + chunk;
+            return true;
+        }
+    }
+    //nothing left
+    return false;
+}
+
+/**
+ * @brief store the information a helper task of a parallel run needs
+ */
+struct ParallelRunContext
+{
+    /**
+     * @brief the range all participants work on
+     */
+    ParallelRange* range;
+    /**
+     * @brief the function each participant executes
+     */
+    void (*participant)(ParallelRange*, void*);
+    /**
+     * @brief the user data for the participant function
+     */
+    void* ctx;
+};
+
+/**
+ * @brief the task that is executed by helping workers
+ * 
+ * @param data a pointer to the parallel run context
+ */
+static void __parallelRunHelper(void* data)
+{
+    ParallelRunContext* run = (ParallelRunContext*)data;
+    (*run->participant)(run->range, run->ctx);
+}
+
+extern "C" {
+
+bool parallelRange_Next(uint64_t* begin, uint64_t* end, ParallelRange* range) {return range->next(*begin, *end);}
+
+void parallel_Run(uint64_t begin, uint64_t end, uint64_t grain, void (*participant)(ParallelRange* range, void* ctx), void* ctx)
+{
+    //nothing to do for an empty range
+    if (begin >= end) {return;}
+    grain = (grain == 0) ? 1 : grain;
+
+    //calculate how many threads can work on the range at all
+    ThreadPool& pool = ThreadPool::shared();
+    uint64_t chunks = (end - begin + grain - 1) / grain;
+    uint64_t participants = (uint64_t)pool.workerCount() + 1;
+    participants = (participants > chunks) ? chunks : participants;
+
+    //a single participant runs on the calling thread without touching the pool
+    ParallelRange range(begin, end, grain, (uint32_t)participants);
+    if (participants == 1)
+    {
+        (*participant)(&range, ctx);
+        return;
+    }
+
+    //start the helpers, then participate on the calling thread
+    ParallelRunContext run{&range, participant, ctx};
+    WaitGroup group;
+    for (uint64_t i = 1; i < participants; ++i) {pool.submit(__parallelRunHelper, &run, &group);}
+    (*participant)(&range, ctx);
+    //wait for the helpers. Helpers that start late find the range exhausted and return instantly.
+    pool.wait(group);
+}
+
+/**
+ * @brief store the data of a C parallel for loop
+ */
+struct ParallelForContext
+{
+    void (*func)(uint64_t, uint64_t, void*);
+    void* ctx;
+};
+
+void parallel_For(uint64_t begin, uint64_t end, uint64_t grain, void (*func)(uint64_t begin, uint64_t end, void* ctx), void* ctx)
+{
+    ParallelForContext loop{func, ctx};
+    parallel_Run(begin, end, grain, [](ParallelRange* range, void* data) {
+        ParallelForContext& l = *(ParallelForContext*)data;
+        uint64_t b, e;
+        while (range->next(b, e)) {(*l.func)(b, e, l.ctx);}
+    }, &loop);
+}
+
+/**
+ * @brief store the data of a C parallel reduction
+ */
+struct ParallelReduceContext
+{
+    void (*func)(uint64_t, uint64_t, void*, void*);
+    void (*combine)(void*, const void*, void*);
+    void* ctx;
+    const uint8_t* identity;
+    void* result;
+    uint64_t resultSize;
+    std::mutex mutex;
+};
+
+/**
+ * @brief the participant of a C parallel reduction
+ * 
+ * @param range the range to reduce
+ * @param data a pointer to the reduction context
+ */
+static void __parallelReduceParticipant(ParallelRange* range, void* data)
+{
+    ParallelReduceContext& r = *(ParallelReduceContext*)data;
+
+    //small results live on the stack, larger ones on the heap
+    uint8_t local[128];
+    uint8_t* partial = (r.resultSize <= sizeof(local)) ? local : new uint8_t[r.resultSize];
+    memcpy(partial, r.identity, r.resultSize);
+
+    //accumulate all chunks of this participant
+    bool any = false;
+    uint64_t b, e;
+    while (range->next(b, e))
+    {
+        any = true;
+        (*r.func)(b, e, partial, r.ctx);
+    }
+
+    //combine the partial result into the result
+    if (any)
+    {
+        std::lock_guard<std::mutex> guard(r.mutex);
+        (*r.combine)(r.result, partial, r.ctx);
+    }
+
+    if (partial != local) {delete[] partial;}
+}
+
+void parallel_Reduce(uint64_t begin, uint64_t end, uint64_t grain, void* result, uint64_t resultSize,
+                     void (*func)(uint64_t begin, uint64_t end, void* partial, void* ctx),
+                     void (*combine)(void* result, const void* partial, void* ctx), void* ctx)
+{
+    //the result is changed while the reduction runs, so keep a copy of the identity
+    uint8_t* identity = new uint8_t[(resultSize == 0) ? 1 : resultSize];
+    memcpy(identity, result, resultSize);
+
+    ParallelReduceContext reduce{func, combine, ctx, identity, result, resultSize, {}};
+    parallel_Run(begin, end, grain, __parallelReduceParticipant, &reduce);
+
+    delete[] identity;
+}
+
+/**
+ * @brief store the data of a C parallel loop over vector elements
+ */
+struct ParallelElementContext
+{
+    void (*func)(void*, uint64_t, void*);
+    void* ctx;
+    uint8_t* data;
+    uint64_t elementSize;
+};
+
+void parallel_ForEachElement(Vector* vec, uint64_t grain, void (*func)(void* element, uint64_t index, void* ctx), void* ctx)
+{
+    ParallelElementContext loop{func, ctx, (uint8_t*)vec->data(), vec->elementSize};
+    parallel_For(0, vec->byteSize / vec->elementSize, grain, [](uint64_t b, uint64_t e, void* data) {
+        ParallelElementContext& l = *(ParallelElementContext*)data;
+        for (uint64_t i = b; i < e; ++i) {(*l.func)(l.data + i*l.elementSize, i, l.ctx);}
+    }, &loop);
+}
+
+/**
+ * @brief store the data of a C parallel reduction over vector elements
+ */
+struct ParallelReduceElementContext
+{
+    void (*func)(const void*, uint64_t, void*, void*);
+    void (*combine)(void*, const void*, void*);
+    void* ctx;
+    const uint8_t* data;
+    uint64_t elementSize;
+};
+
+void parallel_ReduceElements(const Vector* vec, uint64_t grain, void* result, uint64_t resultSize,
+                             void (*func)(const void* element, uint64_t index, void* partial, void* ctx),
+                             void (*combine)(void* result, const void* partial, void* ctx), void* ctx)
+{
+    ParallelReduceElementContext loop{func, combine, ctx, (const uint8_t*)vec->data(), vec->elementSize};
+    parallel_Reduce(0, vec->byteSize / vec->elementSize, grain, result, resultSize,
+        [](uint64_t b, uint64_t e, void* partial, void* data) {
+            ParallelReduceElementContext& l = *(ParallelReduceElementContext*)data;
+            for (uint64_t i = b; i < e; ++i) {(*l.func)(l.data + i*l.elementSize, i, partial, l.ctx);}
+        },
+        [](void* res, const void* partial, void* data) {
+            ParallelReduceElementContext& l = *(ParallelReduceElementContext*)data;
+            (*l.combine)(res, partial, l.ctx);
+        }, &loop);
+}
+
+}
@@ -0,0 +1,291 @@
+/**
+ * @file ParallelFor.h
+ * @author DM8AT
+ * @brief define parallel loops and reductions over index ranges and vectors
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_BG_PARALLEL_FOR_
+#define _GLGE_BG_PARALLEL_FOR_
+
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+//the loops run on the shared thread pool
+#include "ThreadPool.h"
+//vectors can be iterated element wise
+#include "../CBinding/Vector.h"
+
+//include atomics and mutexes for C++
+#if __cplusplus
+#include <atomic>
+#include <mutex>
+#include <type_traits>
+#endif
+
+/**
+ * @brief store the shared state of a parallel loop. All participants of the loop take chunks of the index range from it.
+ * 
+ * The size of the chunks adapts to the remaining work: at first large chunks are handed out to keep the overhead low,
+ * towards the end the chunks get smaller (but never smaller than the grain size) so all participants finish at
+ * roughly the same time.
+ */
+typedef struct s_ParallelRange {
+
+    //check for C++ to define the range
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new Parallel Range
+     * 
+     * @param begin the first index of the range
+     * @param end the index after the last index of the range
+     * @param grain the minimum amount of indices per chunk. 0 is treated as 1.
+     * @param participants the amount of threads that work on the range
+     */
+    s_ParallelRange(uint64_t begin, uint64_t end, uint64_t grain, uint32_t participants) noexcept
+     : m_next(begin), m_end(end), m_grain((grain == 0) ? 1 : grain), m_participants((participants == 0) ? 1 : participants)
+    {}
+
+    /**
+     * @brief take the next chunk of the range
+     * 
+     * @param begin filled with the first index of the chunk
+     * @param end filled with the index after the last index of the chunk
+     * @return true : a chunk was taken
+     * @return false : the range is exhausted
+     */
+    bool next(uint64_t& begin, uint64_t& end) noexcept;
+
+    /**
+     * @brief get the amount of threads that work on the range
+     * 
+     * @return uint32_t the amount of participants
+     */
+    inline uint32_t participants() const noexcept {return m_participants;}
+
+protected:
+
+    /**
+     * @brief the next index that was not handed out yet
+     */
+    std::atomic<uint64_t> m_next;
+    /**
+     * @brief the index after the last index of the range
+     */
+    uint64_t m_end;
+    /**
+     * @brief the minimum size of a chunk
+     */
+    uint64_t m_grain;
+    /**
+     * @brief the amount of participants
+     */
+    uint32_t m_participants;
+
+    #else
+
+    //for windows, add a single byte here to make the struct contain something
+    uint8_t byte;
+
+    #endif
+
+    //for C, this is an opaque structure
+
+} ParallelRange;
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief take the next chunk of a parallel range
+ * 
+ * @param begin filled with the first index of the chunk
+ * @param end filled with the index after the last index of the chunk
+ * @param range a pointer to the range to take the chunk from
+ * @return true : a chunk was taken
+ * @return false : the range is exhausted
+ */
+bool parallelRange_Next(uint64_t* begin, uint64_t* end, ParallelRange* range);
+
+/**
+ * @brief run a function on the calling thread and on workers of the shared thread pool till the range is exhausted
+ * 
+ * This is the building block for the other parallel functions. Each participant should call parallelRange_Next in a loop.
+ * The function returns once all participants returned.
+ * 
+ * @param begin the first index of the range
+ * @param end the index after the last index of the range
+ * @param grain the minimum amount of indices per chunk
+ * @param participant the function each participating thread executes
+ * @param ctx the user data to pass to the participant function
+ */
+void parallel_Run(uint64_t begin, uint64_t end, uint64_t grain, void (*participant)(ParallelRange* range, void* ctx), void* ctx);
+
+/**
+ * @brief execute a function for all chunks of an index range in parallel
+ * 
+ * @param begin the first index of the range
+ * @param end the index after the last index of the range
+ * @param grain the minimum amount of indices per call
+ * @param func the function to call for each chunk. It gets the chunk's begin and end index.
+ * @param ctx the user data to pass to the function
+ */
+void parallel_For(uint64_t begin, uint64_t end, uint64_t grain, void (*func)(uint64_t begin, uint64_t end, void* ctx), void* ctx);
+
+/**
+ * @brief reduce an index range in parallel
+ * 
+ * Each participant starts with a copy of the initial content of result (the identity), accumulates its chunks into
+ * that copy and finally combines it into result. The combine function must be associative and commutative, as the
+ * order of the combination is not defined.
+ * 
+ * @param begin the first index of the range
+ * @param end the index after the last index of the range
+ * @param grain the minimum amount of indices per call
+ * @param result the identity of the reduction on input, the reduced value on output
+ * @param resultSize the size of the result in bytes
+ * @param func the function to accumulate a chunk into a partial result
+ * @param combine the function to combine a partial result into the result. Calls are serialized.
+ * @param ctx the user data to pass to both functions
+ */
+void parallel_Reduce(uint64_t begin, uint64_t end, uint64_t grain, void* result, uint64_t resultSize,
+                     void (*func)(uint64_t begin, uint64_t end, void* partial, void* ctx),
+                     void (*combine)(void* result, const void* partial, void* ctx), void* ctx);
+
+/**
+ * @brief execute a function for each element of a vector in parallel
+ * 
+ * @param vec a pointer to the vector to iterate. It must not be resized during the loop.
+ * @param grain the minimum amount of elements per chunk
+ * @param func the function to call for each element
+ * @param ctx the user data to pass to the function
+ */
+void parallel_ForEachElement(Vector* vec, uint64_t grain, void (*func)(void* element, uint64_t index, void* ctx), void* ctx);
+
+/**
+ * @brief reduce all elements of a vector in parallel
+ * 
+ * @param vec a pointer to the vector to reduce
+ * @param grain the minimum amount of elements per chunk
+ * @param result the identity of the reduction on input, the reduced value on output
+ * @param resultSize the size of the result in bytes
+ * @param func the function to accumulate a single element into a partial result
+ * @param combine the function to combine a partial result into the result. Calls are serialized.
+ * @param ctx the user data to pass to both functions
+ */
+void parallel_ReduceElements(const Vector* vec, uint64_t grain, void* result, uint64_t resultSize,
+                             void (*func)(const void* element, uint64_t index, void* partial, void* ctx),
+                             void (*combine)(void* result, const void* partial, void* ctx), void* ctx);
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+//C++ front ends using callable objects
+#if __cplusplus
+
+/**
+ * @brief execute a callable for an index range in parallel
+ * 
+ * @tparam F the type of the callable. Either callable with a single index or with the begin and end index of a chunk.
+ * @param begin the first index of the range
+ * @param end the index after the last index of the range
+ * @param grain the minimum amount of indices per chunk
+ * @param func the callable to execute
+ */
+template <typename F>
+inline void parallel_for(uint64_t begin, uint64_t end, uint64_t grain, F&& func)
+{
+    parallel_Run(begin, end, grain, [](ParallelRange* range, void* ctx) {
+        F& f = *(std::remove_reference_t<F>*)ctx;
+        uint64_t b, e;
+        while (range->next(b, e))
+        {
+            //call the callable per chunk or per index
+            if constexpr (std::is_invocable_v<F&, uint64_t, uint64_t>) {f(b, e);}
+            else {for (uint64_t i = b; i < e; ++i) {f(i);}}
+        }
+    }, (void*)&func);
+}
+
+/**
+ * @brief reduce an index range in parallel
+ * 
+ * @tparam T the type of the result
+ * @tparam F the type of the accumulation callable. Either callable as (index, T& partial) or as (begin, end, T& partial).
+ * @tparam C the type of the combination callable. Called as T(const T&, const T&). Must be associative and commutative.
+ * @param begin the first index of the range
+ * @param end the index after the last index of the range
+ * @param grain the minimum amount of indices per chunk
+ * @param identity the identity of the reduction
+ * @param func the accumulation callable
+ * @param combine the combination callable
+ * @return T the reduced value
+ */
+template <typename T, typename F, typename C>
+inline T parallel_reduce(uint64_t begin, uint64_t end, uint64_t grain, const T& identity, F&& func, C&& combine)
+{
+    //store everything the participants need
+    struct Context {
+        const T& identity;
+        F& func;
+        C& combine;
+        T result;
+        std::mutex mutex;
+    } context{identity, func, combine, identity, {}};
+
+    parallel_Run(begin, end, grain, [](ParallelRange* range, void* ctx) {
+        Context& c = *(Context*)ctx;
+        //accumulate all chunks of this participant into a local partial result
+        T partial = c.identity;
+        bool any = false;
+        uint64_t b, e;
+        while (range->next(b, e))
+        {
+            any = true;
+            if constexpr (std::is_invocable_v<F&, uint64_t, uint64_t, T&>) {c.func(b, e, partial);}
+            else {for (uint64_t i = b; i < e; ++i) {c.func(i, partial);}}
+        }
+        //only combine if something was accumulated
+        if (!any) {return;}
+        std::lock_guard<std::mutex> guard(c.mutex);
+        c.result = c.combine(c.result, partial);
+    }, &context);
+
+    return context.result;
+}
+
+/**
+ * @brief execute a callable for each element of a vector in parallel
+ * 
+ * @tparam T the type of the elements. Its size must match the element size of the vector.
+ * @tparam F the type of the callable. Called as (T& element, uint64_t index).
+ * @param vec the vector to iterate. It must not be resized during the loop.
+ * @param grain the minimum amount of elements per chunk
+ * @param func the callable to execute
+ */
+template <typename T, typename F>
+inline void parallel_for_each(Vector& vec, uint64_t grain, F&& func)
+{
+    uint8_t* data = (uint8_t*)vec.data();
+    uint64_t elementSize = vec.elementSize;
+    parallel_for(0, vec.byteSize / elementSize, grain, [&](uint64_t b, uint64_t e) {
+        for (uint64_t i = b; i < e; ++i) {func(*(T*)(data + i*elementSize), i);}
+    });
+}
+
+#endif
+
+#endif
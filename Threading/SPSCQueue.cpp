@@ -0,0 +1,122 @@
+/**
+ * @file SPSCQueue.cpp
+ * @author DM8AT
+ * @brief implement the single-producer / single-consumer queue and its C binding
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the queue
+#include "SPSCQueue.h"
+
+//memory management stuff
+#include <cstring>
+
+s_SPSCQueue::s_SPSCQueue(uint64_t elementSize, uint64_t capacity) noexcept
+ : m_elementSize(elementSize)
+{
+    //round the capacity up to the next power of two
+    uint64_t cap = 1;
+    while (cap < capacity) {cap <<= 1;}
+    m_mask = cap - 1;
+    //allocate the storage
+    m_data = new uint8_t[cap * elementSize];
+}
+
+s_SPSCQueue::~s_SPSCQueue()
+{
+    delete[] m_data;
+}
+
+void s_SPSCQueue::copy(uint64_t index, void* memory, uint64_t count, bool toRing) noexcept
+{
+    //split the copy at the end of the ring
+    uint64_t first = index & m_mask;
+    uint64_t firstCount = m_mask + 1 - first;
+    firstCount = (firstCount > count) ? count : firstCount;
+    uint8_t* ring = m_data + first * m_elementSize;
+    uint8_t* mem = (uint8_t*)memory;
+
+    if (toRing)
+    {
+        memcpy(ring, mem, firstCount * m_elementSize);
+        memcpy(m_data, mem + firstCount * m_elementSize, (count - firstCount) * m_elementSize);
+    }
+    else
+    {
+        memcpy(mem, ring, firstCount * m_elementSize);
+        memcpy(mem + firstCount * m_elementSize, m_data, (count - firstCount) * m_elementSize);
+    }
+}
+
+bool s_SPSCQueue::push(const void* element) noexcept
+{
+    return pushBatch(element, 1) == 1;
+}
+
+uint64_t s_SPSCQueue::pushBatch(const void* elements, uint64_t count) noexcept
+{
+    uint64_t tail = m_tail.load(std::memory_order_relaxed);
+    //check the free space against the cached consumer index first, only refresh it if that is not enough
+    uint64_t free = capacity() - (tail - m_headCache);
+    if (free < count)
+    {
+        m_headCache = m_head.load(std::memory_order_acquire);
+        free = capacity() - (tail - m_headCache);
+    }
+    count = (count > free) ? free : count;
+    if (count == 0) {return 0;}
+
+    //copy the elements and publish them
+    copy(tail, (void*)elements, count, true);
+    m_tail.store(tail + count, std::memory_order_release);
+    return count;
+}
+
+bool s_SPSCQueue::pop(void* element) noexcept
+{
+    return popBatch(element, 1) == 1;
+}
+
+uint64_t s_SPSCQueue::popBatch(void* elements, uint64_t maxCount) noexcept
+{
+    uint64_t head = m_head.load(std::memory_order_relaxed);
+    //check the available elements against the cached producer index first, only refresh it if that is not enough
+    uint64_t available = m_tailCache - head;
+    if (available < maxCount)
+    {
+        m_tailCache = m_tail.load(std::memory_order_acquire);
+        available = m_tailCache - head;
+    }
+    uint64_t count = (maxCount > available) ? available : maxCount;
+    if (count == 0) {return 0;}
+
+    //copy the elements out and free the slots
+    copy(head, elements, count, false);
+    m_head.store(head + count, std::memory_order_release);
+    return count;
+}
+
+
+extern "C" {
+
+SPSCQueue* spscQueue_Create(uint64_t elementSize, uint64_t capacity) {return new SPSCQueue(elementSize, capacity);}
+
+void spscQueue_Destroy(SPSCQueue* queue) {delete queue;}
+
+bool spscQueue_Push(const void* element, SPSCQueue* queue) {return queue->push(element);}
+
+uint64_t spscQueue_PushBatch(const void* elements, uint64_t count, SPSCQueue* queue) {return queue->pushBatch(elements, count);}
+
+bool spscQueue_Pop(void* element, SPSCQueue* queue) {return queue->pop(element);}
+
+uint64_t spscQueue_PopBatch(void* elements, uint64_t maxCount, SPSCQueue* queue) {return queue->popBatch(elements, maxCount);}
+
+uint64_t spscQueue_Size(const SPSCQueue* queue) {return queue->size();}
+
+uint64_t spscQueue_Capacity(const SPSCQueue* queue) {return queue->capacity();}
+
+}
@@ -0,0 +1,261 @@
+/**
+ * @file SPSCQueue.h
+ * @author DM8AT
+ * @brief define a lock-free, bounded single-producer / single-consumer ring queue
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_BG_SPSC_QUEUE_
+#define _GLGE_BG_SPSC_QUEUE_
+
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+//include atomics for C++
+#if __cplusplus
+#include <atomic>
+#endif
+
+/**
+ * @brief the size of a cache line the queues pad their members to
+ */
+#define GLGE_QUEUE_CACHE_LINE 64
+
+/**
+ * @brief store a bounded ring queue for exactly one producing and one consuming thread
+ * 
+ * Like a vector, the queue stores elements of a fixed size that is given on creation. The capacity is rounded up to
+ * the next power of two. The producer and the consumer index live on separate cache lines and each side caches the
+ * index of the other side, so the shared cache lines are only touched when the cached value runs out.
+ */
+typedef struct s_SPSCQueue {
+
+    //check for C++ to define the queue
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new SPSC Queue
+     * 
+     * @param elementSize the size of a single element in bytes
+     * @param capacity the minimum amount of elements the queue can hold
+     */
+    s_SPSCQueue(uint64_t elementSize, uint64_t capacity) noexcept;
+
+    /**
+     * @brief Destroy the SPSC Queue
+     */
+    ~s_SPSCQueue();
+
+    /**
+     * @brief add an element to the queue. Only call from the producer thread.
+     * 
+     * @param element a pointer to the element to copy into the queue
+     * @return true : the element was added
+     * @return false : the queue is full
+     */
+    bool push(const void* element) noexcept;
+
+    /**
+     * @brief add multiple elements to the queue. Only call from the producer thread.
+     * 
+     * @param elements a pointer to the tightly packed elements to copy into the queue
+     * @param count the amount of elements to add
+     * @return uint64_t the amount of elements that were added. Less than count if the queue ran full.
+     */
+    uint64_t pushBatch(const void* elements, uint64_t count) noexcept;
+
+    /**
+     * @brief remove the oldest element from the queue. Only call from the consumer thread.
+     * 
+     * @param element a pointer to the memory to copy the element to
+     * @return true : an element was removed
+     * @return false : the queue is empty
+     */
+    bool pop(void* element) noexcept;
+
+    /**
+     * @brief remove multiple elements from the queue. Only call from the consumer thread.
+     * 
+     * @param elements a pointer to the memory to copy the elements to. Must fit maxCount elements.
+     * @param maxCount the maximum amount of elements to remove
+     * @return uint64_t the amount of elements that were removed
+     */
+    uint64_t popBatch(void* elements, uint64_t maxCount) noexcept;
+
+    /**
+     * @brief get an estimation of the amount of queued elements
+     * 
+     * @return uint64_t the amount of queued elements at some point during the call
+     */
+    inline uint64_t size() const noexcept
+    {
+        //load the consumer index first, so the producer index is never behind it
+        uint64_t head = m_head.load(std::memory_order_acquire);
+        return m_tail.load(std::memory_order_acquire) - head;
+    }
+
+    /**
+     * @brief get the maximum amount of elements in the queue
+     * 
+     * @return uint64_t the capacity of the queue
+     */
+    inline uint64_t capacity() const noexcept {return m_mask + 1;}
+
+    /**
+     * @brief get the size of a single element
+     * 
+     * @return uint64_t the size of a single element in bytes
+     */
+    inline uint64_t elementSize() const noexcept {return m_elementSize;}
+
+protected:
+
+    /**
+     * @brief copy elements into or out of the ring while respecting the wrap around
+     * 
+     * @param index the first (unwrapped) index of the ring
+     * @param memory the memory to copy from or to
+     * @param count the amount of elements to copy
+     * @param toRing true : copy from memory into the ring | false : copy from the ring to memory
+     */
+    void copy(uint64_t index, void* memory, uint64_t count, bool toRing) noexcept;
+
+    //read-only after construction
+
+    /**
+     * @brief the element storage
+     */
+    alignas(GLGE_QUEUE_CACHE_LINE) uint8_t* m_data = nullptr;
+    /**
+     * @brief the mask to wrap an index into the ring
+     */
+    uint64_t m_mask = 0;
+    /**
+     * @brief the size of a single element
+     */
+    uint64_t m_elementSize = 0;
+
+    //written by the producer
+
+    /**
+     * @brief the index the next element is written to
+     */
+    alignas(GLGE_QUEUE_CACHE_LINE) std::atomic<uint64_t> m_tail{0};
+    /**
+     * @brief the producer's copy of the consumer index
+     */
+    uint64_t m_headCache = 0;
+
+    //written by the consumer
+
+    /**
+     * @brief the index the next element is read from
+     */
+    alignas(GLGE_QUEUE_CACHE_LINE) std::atomic<uint64_t> m_head{0};
+    /**
+     * @brief the consumer's copy of the producer index
+     */
+    uint64_t m_tailCache = 0;
+
+    #else
+
+    //for windows, add a single byte here to make the struct contain something
+    uint8_t byte;
+
+    #endif
+
+    //for C, this is an opaque structure
+
+} SPSCQueue;
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief create a new single-producer / single-consumer queue
+ * 
+ * @param elementSize the size of a single element in bytes
+ * @param capacity the minimum amount of elements the queue can hold. Rounded up to a power of two.
+ * @return SPSCQueue* a pointer to the new queue
+ */
+SPSCQueue* spscQueue_Create(uint64_t elementSize, uint64_t capacity);
+
+/**
+ * @brief destroy a single-producer / single-consumer queue
+ * 
+ * @param queue a pointer to the queue to destroy
+ */
+void spscQueue_Destroy(SPSCQueue* queue);
+
+/**
+ * @brief add an element to a queue. Only call from the producer thread.
+ * 
+ * @param element a pointer to the element to copy into the queue
+ * @param queue a pointer to the queue to add the element to
+ * @return true : the element was added
+ * @return false : the queue is full
+ */
+bool spscQueue_Push(const void* element, SPSCQueue* queue);
+
+/**
+ * @brief add multiple elements to a queue. Only call from the producer thread.
+ * 
+ * @param elements a pointer to the tightly packed elements to copy into the queue
+ * @param count the amount of elements to add
+ * @param queue a pointer to the queue to add the elements to
+ * @return uint64_t the amount of elements that were added
+ */
+uint64_t spscQueue_PushBatch(const void* elements, uint64_t count, SPSCQueue* queue);
+
+/**
+ * @brief remove the oldest element from a queue. Only call from the consumer thread.
+ * 
+ * @param element a pointer to the memory to copy the element to
+ * @param queue a pointer to the queue to remove the element from
+ * @return true : an element was removed
+ * @return false : the queue is empty
+ */
+bool spscQueue_Pop(void* element, SPSCQueue* queue);
+
+/**
+ * @brief remove multiple elements from a queue. Only call from the consumer thread.
+ * 
+ * @param elements a pointer to the memory to copy the elements to. Must fit maxCount elements.
+ * @param maxCount the maximum amount of elements to remove
+ * @param queue a pointer to the queue to remove the elements from
+ * @return uint64_t the amount of elements that were removed
+ */
+uint64_t spscQueue_PopBatch(void* elements, uint64_t maxCount, SPSCQueue* queue);
+
+/**
+ * @brief get an estimation of the amount of elements in a queue
+ * 
+ * @param queue a pointer to the queue to quarry
+ * @return uint64_t the amount of queued elements
+ */
+uint64_t spscQueue_Size(const SPSCQueue* queue);
+
+/**
+ * @brief get the maximum amount of elements in a queue
+ * 
+ * @param queue a pointer to the queue to quarry
+ * @return uint64_t the capacity of the queue
+ */
+uint64_t spscQueue_Capacity(const SPSCQueue* queue);
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+#endif
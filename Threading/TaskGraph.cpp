@@ -0,0 +1,157 @@
+/**
+ * @file TaskGraph.cpp
+ * @author DM8AT
+ * @brief implement the task graph and its C binding
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the task graph
+#include "TaskGraph.h"
+
+s_TaskGraph::~s_TaskGraph()
+{
+    //never free the nodes while tasks are still running
+    wait();
+}
+
+uint32_t s_TaskGraph::addTask(void (*func)(void*), void* data) noexcept
+{
+    //the graph can't change while it is running
+    if (running()) {return GLGE_TASK_GRAPH_INVALID_TASK;}
+
+    //create the new node
+    TaskGraphNode& node = m_nodes.emplace_back();
+    node.func = func;
+    node.data = data;
+    node.graph = this;
+    m_dirty = true;
+    return (uint32_t)(m_nodes.size() - 1);
+}
+
+bool s_TaskGraph::addDependency(uint32_t before, uint32_t after) noexcept
+{
+    //check that the dependency is sensible
+    if (running() || (before >= m_nodes.size()) || (after >= m_nodes.size()) || (before == after)) {return false;}
+
+    //store the edge
+    m_nodes[before].successors.push_back(&m_nodes[after]);
+    ++m_nodes[after].predecessorCount;
+    m_dirty = true;
+    return true;
+}
+
+bool s_TaskGraph::validate() noexcept
+{
+    //collect the roots of the graph
+    m_roots.clear();
+    for (TaskGraphNode& node : m_nodes) {if (node.predecessorCount == 0) {m_roots.push_back(&node);}}
+
+    //run a topological sort. If not all nodes are visited, there is a cycle.
+    //the remaining counters are used as scratch space, they are reset on submit anyway
+    for (TaskGraphNode& node : m_nodes) {node.remaining.store(node.predecessorCount, std::memory_order_relaxed);}
+    std::vector<TaskGraphNode*> open(m_roots);
+    uint64_t visited = 0;
+    while (!open.empty())
+    {
+        TaskGraphNode* node = open.back();
+        open.pop_back();
+        ++visited;
+        for (TaskGraphNode* succ : node->successors)
+        {if (succ->remaining.fetch_sub(1, std::memory_order_relaxed) == 1) {open.push_back(succ);}}
+    }
+
+    m_dirty = false;
+    return visited == m_nodes.size();
+}
+
+bool s_TaskGraph::submit() noexcept
+{
+    //only a single execution at a time
+    if (running()) {return false;}
+    //re-validate if the graph changed
+    if (m_dirty && !validate())
+    {
+        //keep the graph dirty so it is validated again
+        m_dirty = true;
+        return false;
+    }
+    //an empty graph is done instantly
+    if (m_nodes.empty()) {return true;}
+
+    //reset the dependency counters and register all tasks at the group
+    for (TaskGraphNode& node : m_nodes) {node.remaining.store(node.predecessorCount, std::memory_order_relaxed);}
+    m_group.add(m_nodes.size());
+
+    //start all tasks without dependencies
+    for (TaskGraphNode* root : m_roots) {m_pool->submit(runNode, root);}
+    return true;
+}
+
+void s_TaskGraph::wait() noexcept
+{
+    //help the pool while waiting
+    m_pool->wait(m_group);
+}
+
+bool s_TaskGraph::clear() noexcept
+{
+    //the graph can't change while it is running
+    if (running()) {return false;}
+    m_nodes.clear();
+    m_roots.clear();
+    m_dirty = false;
+    return true;
+}
+
+void s_TaskGraph::runNode(void* data)
+{
+    TaskGraphNode* node = (TaskGraphNode*)data;
+    s_TaskGraph* graph = node->graph;
+
+    while (node)
+    {
+        //execute the task itself
+        (*node->func)(node->data);
+
+        //release the successors. The first one that gets ready is executed directly on this thread,
+        //all others are handed to the pool.
+        TaskGraphNode* next = nullptr;
+        for (TaskGraphNode* succ : node->successors)
+        {
+            if (succ->remaining.fetch_sub(1, std::memory_order_acq_rel) != 1) {continue;}
+            if (!next) {next = succ;}
+            else {graph->m_pool->submit(runNode, succ);}
+        }
+
+        //the task is done. If there is a next task, the group can't reach zero here, so the graph is still alive.
+        graph->m_group.done();
+        node = next;
+    }
+}
+
+
+extern "C" {
+
+TaskGraph* taskGraph_Create(ThreadPool* pool) {return new TaskGraph(pool);}
+
+void taskGraph_Destroy(TaskGraph* graph) {delete graph;}
+
+uint32_t taskGraph_AddTask(void (*func)(void*), void* data, TaskGraph* graph) {return graph->addTask(func, data);}
+
+bool taskGraph_AddDependency(uint32_t before, uint32_t after, TaskGraph* graph) {return graph->addDependency(before, after);}
+
+bool taskGraph_Submit(TaskGraph* graph) {return graph->submit();}
+
+void taskGraph_Wait(TaskGraph* graph) {graph->wait();}
+
+bool taskGraph_Run(TaskGraph* graph) {return graph->run();}
+
+bool taskGraph_Clear(TaskGraph* graph) {return graph->clear();}
+
+uint32_t taskGraph_TaskCount(const TaskGraph* graph) {return graph->taskCount();}
+
+}
@@ -0,0 +1,255 @@
+/**
+ * @file ThreadPool.cpp
+ * @author DM8AT
+ * @brief implement the work-stealing thread pool and its C binding
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the thread pool
+#include "ThreadPool.h"
+
+//the per-worker deques
+#include <deque>
+
+/**
+ * @brief the amount of times an idle worker searches for work before it goes to sleep
+ */
+#define GLGE_THREAD_POOL_SPIN_COUNT 64
+
+/**
+ * @brief store the state of a single worker. Each worker lives on its own cache line(s).
+ */
+struct alignas(64) ThreadPoolWorker
+{
+    /**
+     * @brief the pool the worker belongs to
+     */
+    s_ThreadPool* pool = nullptr;
+    /**
+     * @brief the index of the worker inside of the pool
+     */
+    uint32_t index = 0;
+    /**
+     * @brief the mutex that protects the deque
+     */
+    std::mutex mutex;
+    /**
+     * @brief the tasks of the worker. The owner works at the back, thieves steal from the front.
+     */
+    std::deque<ThreadPoolTask> tasks;
+};
+
+/**
+ * @brief store the worker the current thread belongs to (if any)
+ */
+static thread_local ThreadPoolWorker* __currentWorker = nullptr;
+
+s_ThreadPool::s_ThreadPool(uint32_t workerCount)
+{
+    //default to one worker per hardware thread
+    if (workerCount == 0) {workerCount = Thread::hardware_concurrency();}
+    //there has to be at least a single worker
+    m_workerCount = (workerCount == 0) ? 1 : workerCount;
+
+    //create the worker states
+    m_workers = new ThreadPoolWorker[m_workerCount];
+    for (uint32_t i = 0; i < m_workerCount; ++i)
+    {
+        m_workers[i].pool = this;
+        m_workers[i].index = i;
+    }
+
+    //start all worker threads
+    m_threads = new Thread*[m_workerCount];
+    for (uint32_t i = 0; i < m_workerCount; ++i)
+    {m_threads[i] = new Thread(workerMain, &m_workers[i]);}
+}
+
+s_ThreadPool::~s_ThreadPool()
+{
+    //signal the shutdown and wake all sleeping workers
+    {
+        std::lock_guard<std::mutex> guard(m_sleepMutex);
+        m_stop.store(true, std::memory_order_release);
+    }
+    m_sleepCond.notify_all();
+
+    //join all workers. They finish all queued tasks first.
+    for (uint32_t i = 0; i < m_workerCount; ++i) {delete m_threads[i];}
+    delete[] m_threads;
+    delete[] m_workers;
+}
+
+void s_ThreadPool::submit(void (*func)(void*), void* data, WaitGroup* group) noexcept
+{
+    //register the task at the group before it can possibly finish
+    if (group) {group->add(1);}
+
+    //tasks from own workers go to their own deque, others are distributed round-robin
+    ThreadPoolWorker* worker = __currentWorker;
+    if (!worker || (worker->pool != this))
+    {worker = &m_workers[m_nextWorker.fetch_add(1, std::memory_order_relaxed) % m_workerCount];}
+
+    //count the task before it becomes visible, so the pending counter never drops below zero
+    m_pending.fetch_add(1, std::memory_order_seq_cst);
+    {
+        std::lock_guard<std::mutex> guard(worker->mutex);
+        worker->tasks.push_back(ThreadPoolTask{func, data, group});
+    }
+
+    //wake a sleeping worker if there is one
+    if (m_sleeping.load(std::memory_order_seq_cst) > 0)
+    {
+        std::lock_guard<std::mutex> guard(m_sleepMutex);
+        m_sleepCond.notify_one();
+    }
+}
+
+bool s_ThreadPool::findTask(uint32_t self, bool owner, ThreadPoolTask& task) noexcept
+{
+    //quick check if there is anything to do at all
+    if (m_pending.load(std::memory_order_acquire) == 0) {return false;}
+
+    //first, pop the newest task from the own deque
+    if (owner)
+    {
+        ThreadPoolWorker& own = m_workers[self];
+        std::lock_guard<std::mutex> guard(own.mutex);
+        if (!own.tasks.empty())
+        {
+            task = own.tasks.back();
+            own.tasks.pop_back();
+            m_pending.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    //then, steal the oldest task from another worker. Threads outside of the pool steal from all workers.
+    for (uint32_t i = owner ? 1 : 0; i < m_workerCount; ++i)
+    {
+        ThreadPoolWorker& victim = m_workers[(self + i) % m_workerCount];
+        //don't block on a busy deque, just go to the next one
+        std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+        if (!lock.owns_lock() || victim.tasks.empty()) {continue;}
+        task = victim.tasks.front();
+        victim.tasks.pop_front();
+        m_pending.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    //nothing found
+    return false;
+}
+
+void s_ThreadPool::execute(const ThreadPoolTask& task) noexcept
+{
+    //run the task and mark it as done
+    (*task.func)(task.data);
+    if (task.group) {task.group->done();}
+}
+
+bool s_ThreadPool::runPending() noexcept
+{
+    //workers of this pool start at their own deque, all other threads only steal
+    ThreadPoolWorker* worker = __currentWorker;
+    bool owner = worker && (worker->pool == this);
+    uint32_t self = owner ? worker->index : 0;
+
+    //try to find a task and execute it
+    ThreadPoolTask task;
+    if (!findTask(self, owner, task)) {return false;}
+    execute(task);
+    return true;
+}
+
+void s_ThreadPool::wait(WaitGroup& group) noexcept
+{
+    //help executing tasks while the group is not done
+    //this is also done for external threads, the caller would idle anyway
+    while (!group.isDone())
+    {
+        //if there is nothing to do, sleep shortly on the group. This is woken instantly when the group finishes.
+        if (!runPending()) {group.waitFor(100);}
+    }
+    //always finish with a blocking wait, this makes sure the group may be destroyed afterwards
+    group.wait();
+}
+
+int32_t s_ThreadPool::currentWorkerIndex() const noexcept
+{
+    ThreadPoolWorker* worker = __currentWorker;
+    return (worker && (worker->pool == this)) ? (int32_t)worker->index : -1;
+}
+
+s_ThreadPool& s_ThreadPool::shared()
+{
+    //created on first use, one worker per hardware thread
+    static s_ThreadPool pool;
+    return pool;
+}
+
+void s_ThreadPool::workerMain(void* data)
+{
+    //store the worker for the current thread
+    ThreadPoolWorker* worker = (ThreadPoolWorker*)data;
+    s_ThreadPool* pool = worker->pool;
+    __currentWorker = worker;
+
+    ThreadPoolTask task;
+    while (true)
+    {
+        //search for work a few times before going to sleep
+        bool found = false;
+        for (uint32_t i = 0; (i < GLGE_THREAD_POOL_SPIN_COUNT) && !found; ++i)
+        {
+            found = pool->findTask(worker->index, true, task);
+            if (!found) {std::this_thread::yield();}
+        }
+
+        //if work was found, execute it and search for the next task
+        if (found)
+        {
+            execute(task);
+            continue;
+        }
+
+        //sleep till new work arrives or the pool shuts down
+        std::unique_lock<std::mutex> lock(pool->m_sleepMutex);
+        pool->m_sleeping.fetch_add(1, std::memory_order_seq_cst);
+        pool->m_sleepCond.wait(lock, [pool]{
+            return (pool->m_pending.load(std::memory_order_seq_cst) > 0) || pool->m_stop.load(std::memory_order_acquire);
+        });
+        pool->m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+
+        //only quit once all work is done
+        if (pool->m_stop.load(std::memory_order_acquire) && (pool->m_pending.load(std::memory_order_acquire) == 0)) {break;}
+    }
+
+    //the thread no longer belongs to a worker
+    __currentWorker = nullptr;
+}
+
+
+extern "C" {
+
+ThreadPool* threadPool_Create(uint32_t workerCount) {return new ThreadPool(workerCount);}
+
+void threadPool_Destroy(ThreadPool* pool) {delete pool;}
+
+ThreadPool* threadPool_GetShared() {return &ThreadPool::shared();}
+
+void threadPool_Submit(void (*func)(void*), void* data, ThreadPool* pool) {pool->submit(func, data);}
+
+void threadPool_SubmitGrouped(void (*func)(void*), void* data, WaitGroup* group, ThreadPool* pool) {pool->submit(func, data, group);}
+
+void threadPool_Wait(WaitGroup* group, ThreadPool* pool) {pool->wait(*group);}
+
+uint32_t threadPool_WorkerCount(const ThreadPool* pool) {return pool->workerCount();}
+
+int32_t threadPool_CurrentWorkerIndex(const ThreadPool* pool) {return pool->currentWorkerIndex();}
+
+}
@@ -0,0 +1,299 @@
+/**
+ * @file ThreadPool.h
+ * @author DM8AT
+ * @brief define a persistent, work-stealing thread pool
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_BG_THREAD_POOL_
+#define _GLGE_BG_THREAD_POOL_
+
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+//the wait group is used to wait for the completion of submitted tasks
+#include "WaitGroup.h"
+//the workers are normal threads
+#include "../CBinding/Thread.h"
+
+//include atomics and mutexes for C++
+#if __cplusplus
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <utility>
+#include <type_traits>
+#endif
+
+/**
+ * @brief store a single task that can be executed by a thread pool
+ */
+typedef struct s_ThreadPoolTask {
+    /**
+     * @brief the function to execute
+     */
+    void (*func)(void*);
+    /**
+     * @brief the data to pass to the function
+     */
+    void* data;
+    /**
+     * @brief an optional wait group that is marked as done once the task finished
+     */
+    WaitGroup* group;
+} ThreadPoolTask;
+
+//the per-worker state is only known to the implementation
+#if __cplusplus
+struct ThreadPoolWorker;
+#endif
+
+/**
+ * @brief store a persistent thread pool
+ * 
+ * Every worker owns a deque of tasks. Tasks submitted from a worker are pushed to the worker's own deque and executed
+ * in LIFO order, while idle workers steal the oldest tasks from other workers. Tasks submitted from outside of the pool
+ * are distributed over the workers round-robin. Idle workers sleep till new work arrives.
+ */
+typedef struct s_ThreadPool {
+
+    //check for C++ to define the thread pool
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new Thread Pool
+     * 
+     * @param workerCount the amount of worker threads to create. 0 means one worker per hardware thread.
+     */
+    s_ThreadPool(uint32_t workerCount = 0);
+
+    /**
+     * @brief Destroy the Thread Pool
+     * 
+     * All tasks that are still queued are executed before the workers are joined
+     */
+    ~s_ThreadPool();
+
+    /**
+     * @brief submit a task to the pool
+     * 
+     * @param func the function to execute on a worker thread
+     * @param data the data to pass to the function
+     * @param group an optional wait group. It is incremented now and marked as done once the task finished.
+     */
+    void submit(void (*func)(void*), void* data, WaitGroup* group = nullptr) noexcept;
+
+    /**
+     * @brief submit any callable object to the pool
+     * 
+     * @tparam F the type of the callable object. Must be callable without arguments.
+     * @param func the callable object to execute on a worker thread
+     * @param group an optional wait group. It is incremented now and marked as done once the task finished.
+     */
+    template <typename F>
+    inline void submit(F&& func, WaitGroup* group = nullptr)
+    {
+        //store the callable on the heap and use a small trampoline to call and delete it
+        using Callable = std::decay_t<F>;
+        submit([](void* data) {
+            Callable* callable = (Callable*)data;
+            (*callable)();
+            delete callable;
+        }, new Callable(std::forward<F>(func)), group);
+    }
+
+    /**
+     * @brief wait for a wait group to finish. If called from a worker of this pool, the worker executes other tasks while waiting.
+     * 
+     * @param group the wait group to wait for
+     */
+    void wait(WaitGroup& group) noexcept;
+
+    /**
+     * @brief try to execute a single queued task on the calling thread
+     * 
+     * @return true : a task was executed
+     * @return false : no task was available
+     */
+    bool runPending() noexcept;
+
+    /**
+     * @brief get the amount of worker threads
+     * 
+     * @return uint32_t the amount of worker threads
+     */
+    inline uint32_t workerCount() const noexcept {return m_workerCount;}
+
+    /**
+     * @brief get the index of the calling thread inside of this pool
+     * 
+     * @return int32_t the index of the worker or -1 if the calling thread is not a worker of this pool
+     */
+    int32_t currentWorkerIndex() const noexcept;
+
+    /**
+     * @brief get a pool that is shared by the whole application. It is created on first use with one worker per hardware thread.
+     * 
+     * @return s_ThreadPool& a reference to the shared pool
+     */
+    static s_ThreadPool& shared();
+
+protected:
+
+    /**
+     * @brief the function executed by all worker threads
+     * 
+     * @param worker a pointer to the worker state
+     */
+    static void workerMain(void* worker);
+
+    /**
+     * @brief try to pop a task from the own deque or steal one from another worker
+     * 
+     * @param self the index of the worker to start searching at
+     * @param owner true if the caller is the worker self and may pop its newest task, false to only steal the oldest tasks
+     * @param task the task to fill
+     * @return true : a task was found
+     * @return false : no task was found
+     */
+    bool findTask(uint32_t self, bool owner, ThreadPoolTask& task) noexcept;
+
+    /**
+     * @brief execute a task and signal its wait group
+     * 
+     * @param task the task to execute
+     */
+    static void execute(const ThreadPoolTask& task) noexcept;
+
+    /**
+     * @brief the amount of worker threads
+     */
+    uint32_t m_workerCount = 0;
+    /**
+     * @brief the per-worker states
+     */
+    ThreadPoolWorker* m_workers = nullptr;
+    /**
+     * @brief the worker threads
+     */
+    Thread** m_threads = nullptr;
+    /**
+     * @brief the amount of tasks that are queued but not started yet
+     */
+    std::atomic<uint64_t> m_pending{0};
+    /**
+     * @brief the amount of workers that are currently sleeping
+     */
+    std::atomic<uint32_t> m_sleeping{0};
+    /**
+     * @brief the next worker to push an external task to
+     */
+    std::atomic<uint32_t> m_nextWorker{0};
+    /**
+     * @brief true if the pool is shutting down
+     */
+    std::atomic<bool> m_stop{false};
+    /**
+     * @brief the mutex for the sleeping workers
+     */
+    std::mutex m_sleepMutex;
+    /**
+     * @brief the condition variable idle workers sleep on
+     */
+    std::condition_variable m_sleepCond;
+
+    #else
+
+    //for windows, add a single byte here to make the struct contain something
+    uint8_t byte;
+
+    #endif
+
+    //for C, this is an opaque structure
+
+} ThreadPool;
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief create a new thread pool
+ * 
+ * @param workerCount the amount of worker threads to create. 0 means one worker per hardware thread.
+ * @return ThreadPool* a pointer to the new thread pool
+ */
+ThreadPool* threadPool_Create(uint32_t workerCount);
+
+/**
+ * @brief destroy a thread pool. All queued tasks are executed before the workers are joined.
+ * 
+ * @param pool a pointer to the thread pool to destroy
+ */
+void threadPool_Destroy(ThreadPool* pool);
+
+/**
+ * @brief get the thread pool that is shared by the whole application
+ * 
+ * @return ThreadPool* a pointer to the shared thread pool. Must not be destroyed.
+ */
+ThreadPool* threadPool_GetShared();
+
+/**
+ * @brief submit a task to a thread pool
+ * 
+ * @param func the function to execute on a worker thread
+ * @param data the data to pass to the function
+ * @param pool a pointer to the thread pool to execute the task on
+ */
+void threadPool_Submit(void (*func)(void*), void* data, ThreadPool* pool);
+
+/**
+ * @brief submit a task to a thread pool and track its completion with a wait group
+ * 
+ * @param func the function to execute on a worker thread
+ * @param data the data to pass to the function
+ * @param group the wait group to add the task to. It is marked as done once the task finished.
+ * @param pool a pointer to the thread pool to execute the task on
+ */
+void threadPool_SubmitGrouped(void (*func)(void*), void* data, WaitGroup* group, ThreadPool* pool);
+
+/**
+ * @brief wait for a wait group. Workers of the pool execute other tasks while waiting.
+ * 
+ * @param group the wait group to wait for
+ * @param pool a pointer to the thread pool the tasks of the group were submitted to
+ */
+void threadPool_Wait(WaitGroup* group, ThreadPool* pool);
+
+/**
+ * @brief get the amount of worker threads of a thread pool
+ * 
+ * @param pool a pointer to the thread pool to quarry
+ * @return uint32_t the amount of worker threads
+ */
+uint32_t threadPool_WorkerCount(const ThreadPool* pool);
+
+/**
+ * @brief get the index of the calling thread inside of a thread pool
+ * 
+ * @param pool a pointer to the thread pool to quarry
+ * @return int32_t the index of the worker or -1 if the calling thread is not a worker of the pool
+ */
+int32_t threadPool_CurrentWorkerIndex(const ThreadPool* pool);
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+#endif
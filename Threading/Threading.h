@@ -0,0 +1,34 @@
+/**
+ * @file Threading.h
+ * @author DM8AT
+ * @brief include all threading related stuff that builds on top of the C bindings
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_BG_THREADING_
+#define _GLGE_BG_THREADING_
+
+//include wait groups
+#include "WaitGroup.h"
+//include the thread pool
+#include "ThreadPool.h"
+//include parallel loops
+#include "ParallelFor.h"
+//include task graphs
+#include "TaskGraph.h"
+//include lock-free queues
+#include "SPSCQueue.h"
+#include "MPMCQueue.h"
+//include epoch based memory reclamation
+#include "Epoch.h"
+//include timer wheels
+#include "TimerWheel.h"
+//include coroutine tasks (C++20 only)
+#include "Coroutine.h"
+
+#endif
@@ -0,0 +1,285 @@
+/**
+ * @file TimerWheel.cpp
+ * @author DM8AT
+ * @brief implement the hierarchical timer wheel and its C binding
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the timer wheel
+#include "TimerWheel.h"
+
+/**
+ * @brief the amount of bits of the tick each level of the wheel uses
+ */
+#define GLGE_TIMER_WHEEL_BITS 6
+
+/**
+ * @brief store a single timer. Unused timers form a list of free timers.
+ */
+struct TimerWheelNode
+{
+    /**
+     * @brief the function to call
+     */
+    void (*func)(void*) = nullptr;
+    /**
+     * @brief the data to pass to the function
+     */
+    void* data = nullptr;
+    /**
+     * @brief the tick the timer expires at
+     */
+    uint64_t expires = 0;
+    /**
+     * @brief the interval in ticks or 0 for a single execution
+     */
+    uint64_t interval = 0;
+    /**
+     * @brief the previous timer in the slot or UINT32_MAX
+     */
+    uint32_t prev = UINT32_MAX;
+    /**
+     * @brief the next timer in the slot or the next free timer, UINT32_MAX if there is none
+     */
+    uint32_t next = UINT32_MAX;
+    /**
+     * @brief the slot the timer is stored in or UINT32_MAX if the timer is not pending
+     */
+    uint32_t slot = UINT32_MAX;
+    /**
+     * @brief incremented every time the timer is freed, so old handles don't match anymore
+     */
+    uint32_t generation = 1;
+};
+
+s_TimerWheel::s_TimerWheel(s_ThreadPool* pool, uint64_t resolutionUs)
+ : m_start(std::chrono::steady_clock::now()), m_resolution((resolutionUs == 0) ? 1000 : resolutionUs), m_pool(pool)
+{
+    for (uint32_t& slot : m_slots) {slot = UINT32_MAX;}
+    m_thread = new Thread(serviceMain, this);
+}
+
+s_TimerWheel::~s_TimerWheel()
+{
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_stop = true;
+    }
+    m_cond.notify_one();
+    delete m_thread;
+}
+
+TimerHandle s_TimerWheel::scheduleAt(uint64_t deadlineUs, void (*func)(void*), void* data)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    TimerHandle handle = create(tickOf(deadlineUs), 0, func, data);
+    lock.unlock();
+    m_cond.notify_one();
+    return handle;
+}
+
+TimerHandle s_TimerWheel::scheduleEvery(uint64_t intervalUs, void (*func)(void*), void* data)
+{
+    uint64_t interval = tickOf(intervalUs);
+    interval = (interval == 0) ? 1 : interval;
+    uint64_t start = now();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    TimerHandle handle = create(tickOf(start) + interval, interval, func, data);
+    lock.unlock();
+    m_cond.notify_one();
+    return handle;
+}
+
+bool s_TimerWheel::cancel(TimerHandle handle)
+{
+    uint32_t index = (uint32_t)(handle & UINT32_MAX);
+    uint32_t generation = (uint32_t)(handle >> 32);
+
+    std::lock_guard<std::mutex> guard(m_mutex);
+    //only pending timers with a matching generation can be cancelled
+    if ((index >= m_nodes.size()) || (m_nodes[index].generation != generation) || (m_nodes[index].slot == UINT32_MAX)) {return false;}
+    unlink(index);
+    release(index);
+    return true;
+}
+
+uint64_t s_TimerWheel::pendingCount()
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_count;
+}
+
+TimerHandle s_TimerWheel::create(uint64_t expires, uint64_t interval, void (*func)(void*), void* data)
+{
+    //the wheel does not advance without timers, so catch up to the current time first
+    if (m_count == 0)
+    {
+        uint64_t current = now() / m_resolution;
+        m_tick = (current > m_tick) ? current : m_tick;
+    }
+
+    //re-use a free timer or create a new one
+    uint32_t index = m_free;
+    if (index != UINT32_MAX) {m_free = m_nodes[index].next;}
+    else
+    {
+        index = (uint32_t)m_nodes.size();
+        m_nodes.emplace_back();
+    }
+
+    TimerWheelNode& node = m_nodes[index];
+    node.func = func;
+    node.data = data;
+    node.expires = expires;
+    node.interval = interval;
+    insert(index);
+    ++m_count;
+    return ((TimerHandle)node.generation << 32) | index;
+}
+
+void s_TimerWheel::release(uint32_t index) noexcept
+{
+    TimerWheelNode& node = m_nodes[index];
+    //invalidate all handles of the timer
+    ++node.generation;
+    node.generation = (node.generation == 0) ? 1 : node.generation;
+    node.next = m_free;
+    m_free = index;
+    --m_count;
+}
+
+void s_TimerWheel::insert(uint32_t index) noexcept
+{
+    TimerWheelNode& node = m_nodes[index];
+    //timers in the past expire with the next tick
+    uint64_t expires = (node.expires < m_tick) ? m_tick : node.expires;
+    uint64_t delta = expires - m_tick;
+
+    //find the lowest level that covers the distance to the deadline
+    uint32_t level = 0;
+    while ((level < GLGE_TIMER_WHEEL_LEVELS - 1) && (delta >= (1ull << (GLGE_TIMER_WHEEL_BITS * (level + 1))))) {++level;}
+    //deadlines beyond the range of the wheel wait in the farthest slot and are sorted in again once it is reached
+    if (delta >= (1ull << (GLGE_TIMER_WHEEL_BITS * GLGE_TIMER_WHEEL_LEVELS))) {expires = m_tick + (1ull << (GLGE_TIMER_WHEEL_BITS * GLGE_TIMER_WHEEL_LEVELS)) - 1;}
+    uint32_t slot = level * GLGE_TIMER_WHEEL_SLOTS + (uint32_t)((expires >> (GLGE_TIMER_WHEEL_BITS * level)) & (GLGE_TIMER_WHEEL_SLOTS - 1));
+
+    //push the timer to the front of the slot's list
+    node.slot = slot;
+    node.prev = UINT32_MAX;
+    node.next = m_slots[slot];
+    if (node.next != UINT32_MAX) {m_nodes[node.next].prev = index;}
+    m_slots[slot] = index;
+}
+
+void s_TimerWheel::unlink(uint32_t index) noexcept
+{
+    TimerWheelNode& node = m_nodes[index];
+    if (node.prev != UINT32_MAX) {m_nodes[node.prev].next = node.next;}
+    else {m_slots[node.slot] = node.next;}
+    if (node.next != UINT32_MAX) {m_nodes[node.next].prev = node.prev;}
+    node.slot = UINT32_MAX;
+}
+
+void s_TimerWheel::processTick()
+{
+    //once a level wrapped around, distribute the next slot of the level above over the lower levels
+    for (uint32_t level = 1; level < GLGE_TIMER_WHEEL_LEVELS; ++level)
+    {
+        if ((m_tick & ((1ull << (GLGE_TIMER_WHEEL_BITS * level)) - 1)) != 0) {break;}
+        uint32_t slot = level * GLGE_TIMER_WHEEL_SLOTS + (uint32_t)((m_tick >> (GLGE_TIMER_WHEEL_BITS * level)) & (GLGE_TIMER_WHEEL_SLOTS - 1));
+        uint32_t index = m_slots[slot];
+        m_slots[slot] = UINT32_MAX;
+        while (index != UINT32_MAX)
+        {
+            uint32_t next = m_nodes[index].next;
+            insert(index);
+            index = next;
+        }
+    }
+
+    //take all timers of the current tick
+    uint32_t slot = (uint32_t)(m_tick & (GLGE_TIMER_WHEEL_SLOTS - 1));
+    uint32_t index = m_slots[slot];
+    m_slots[slot] = UINT32_MAX;
+    while (index != UINT32_MAX)
+    {
+        TimerWheelNode& node = m_nodes[index];
+        uint32_t next = node.next;
+        node.slot = UINT32_MAX;
+        m_due.push_back(ThreadPoolTask{node.func, node.data, nullptr});
+
+        if (node.interval == 0) {release(index);}
+        else
+        {
+            //keep the phase of periodic timers, skip executions that were missed completely
+            do {node.expires += node.interval;} while (node.expires <= m_tick);
+            insert(index);
+        }
+        index = next;
+    }
+
+    ++m_tick;
+}
+
+void s_TimerWheel::serviceMain(void* data)
+{
+    s_TimerWheel* wheel = (s_TimerWheel*)data;
+    std::unique_lock<std::mutex> lock(wheel->m_mutex);
+    while (!wheel->m_stop)
+    {
+        //without timers, sleep till one is scheduled
+        if (wheel->m_count == 0) {wheel->m_cond.wait(lock); continue;}
+
+        //wait till the next tick started. The ticks are calculated from the start, so waking up late does not drift.
+        uint64_t current = wheel->now() / wheel->m_resolution;
+        if (wheel->m_tick > current)
+        {
+            wheel->m_cond.wait_until(lock, wheel->m_start + std::chrono::microseconds(wheel->m_tick * wheel->m_resolution));
+            continue;
+        }
+
+        //process all ticks that passed
+        while ((wheel->m_tick <= current) && (wheel->m_count != 0)) {wheel->processTick();}
+        if (wheel->m_count == 0) {wheel->m_tick = current + 1;}
+        if (wheel->m_due.empty()) {continue;}
+
+        //execute the callbacks without holding the lock, so they can schedule and cancel timers
+        std::vector<ThreadPoolTask> due;
+        due.swap(wheel->m_due);
+        lock.unlock();
+        for (const ThreadPoolTask& task : due)
+        {
+            if (wheel->m_pool) {wheel->m_pool->submit(task.func, task.data);}
+            else {(*task.func)(task.data);}
+        }
+        due.clear();
+        lock.lock();
+        //keep the allocation for the next step
+        if (wheel->m_due.empty()) {wheel->m_due.swap(due);}
+    }
+}
+
+
+extern "C" {
+
+TimerWheel* timerWheel_Create(ThreadPool* pool, uint64_t resolutionUs) {return new TimerWheel(pool, resolutionUs);}
+
+void timerWheel_Destroy(TimerWheel* wheel) {delete wheel;}
+
+TimerHandle timerWheel_ScheduleAt(uint64_t deadlineUs, void (*func)(void*), void* data, TimerWheel* wheel) {return wheel->scheduleAt(deadlineUs, func, data);}
+
+TimerHandle timerWheel_ScheduleAfter(uint64_t delayUs, void (*func)(void*), void* data, TimerWheel* wheel) {return wheel->scheduleAfter(delayUs, func, data);}
+
+TimerHandle timerWheel_ScheduleEvery(uint64_t intervalUs, void (*func)(void*), void* data, TimerWheel* wheel) {return wheel->scheduleEvery(intervalUs, func, data);}
+
+bool timerWheel_Cancel(TimerHandle handle, TimerWheel* wheel) {return wheel->cancel(handle);}
+
+uint64_t timerWheel_PendingCount(TimerWheel* wheel) {return wheel->pendingCount();}
+
+uint64_t timerWheel_Now(const TimerWheel* wheel) {return wheel->now();}
+
+}
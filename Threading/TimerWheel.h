@@ -0,0 +1,344 @@
+/**
+ * @file TimerWheel.h
+ * @author DM8AT
+ * @brief define a hierarchical timer wheel that executes delayed and periodic callbacks
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_BG_TIMER_WHEEL_
+#define _GLGE_BG_TIMER_WHEEL_
+
+//booleans are required
+#include <stdbool.h>
+//specific sized integers are always required
+#include <stdint.h>
+
+//callbacks can be executed on a thread pool
+#include "ThreadPool.h"
+
+//include the synchronisation primitives and containers for C++
+#if __cplusplus
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <vector>
+#endif
+
+/**
+ * @brief the amount of levels of a timer wheel
+ */
+#define GLGE_TIMER_WHEEL_LEVELS 4
+/**
+ * @brief the amount of slots of each level of a timer wheel. Each level covers 64 times the range of the level below.
+ */
+#define GLGE_TIMER_WHEEL_SLOTS 64
+/**
+ * @brief the handle that never belongs to a timer
+ */
+#define GLGE_TIMER_INVALID_HANDLE 0
+
+/**
+ * @brief a handle to a scheduled timer. Handles of finished timers are never re-used for other timers.
+ */
+typedef uint64_t TimerHandle;
+
+//the timers are only known to the implementation
+#if __cplusplus
+struct TimerWheelNode;
+#endif
+
+/**
+ * @brief store a hierarchical timer wheel
+ * 
+ * Timers are sorted into slots by their deadline: the first level has one slot per tick, every further level has one
+ * slot per 64 slots of the level below. Once the lowest level wrapped around, the timers of the next slot of the level
+ * above are distributed over the lower levels. This makes scheduling and cancelling a timer O(1), independent of the
+ * amount of pending timers. A single service thread advances the wheel. Periodic timers are re-scheduled relative to
+ * their previous deadline, so they don't drift.
+ */
+typedef struct s_TimerWheel {
+
+    //check for C++ to define the timer wheel
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new Timer Wheel and start its service thread
+     * 
+     * @param pool the thread pool to execute the callbacks on or NULL to execute them on the service thread
+     * @param resolutionUs the length of a single tick in microseconds. Deadlines are rounded up to full ticks. 0 means 1000.
+     */
+    s_TimerWheel(s_ThreadPool* pool = nullptr, uint64_t resolutionUs = 1000);
+
+    /**
+     * @brief Destroy the Timer Wheel. Timers that did not expire yet are dropped without calling them.
+     */
+    ~s_TimerWheel();
+
+    /**
+     * @brief execute a callback once a point in time is reached
+     * 
+     * @param deadlineUs the point in time in microseconds of the wheel's clock (see now)
+     * @param func the function to call
+     * @param data the data to pass to the function
+     * @return TimerHandle the handle of the timer
+     */
+    TimerHandle scheduleAt(uint64_t deadlineUs, void (*func)(void*), void* data);
+
+    /**
+     * @brief execute a callback once after a delay
+     * 
+     * @param delayUs the delay in microseconds
+     * @param func the function to call
+     * @param data the data to pass to the function
+     * @return TimerHandle the handle of the timer
+     */
+    inline TimerHandle scheduleAfter(uint64_t delayUs, void (*func)(void*), void* data) {return scheduleAt(now() + delayUs, func, data);}
+
+    /**
+     * @brief execute a callback periodically till the timer is cancelled
+     * 
+     * If the callbacks fall behind by more than a full interval, the missed executions are skipped.
+     * 
+     * @param intervalUs the time between two executions in microseconds. The first execution is after one interval.
+     * @param func the function to call
+     * @param data the data to pass to the function
+     * @return TimerHandle the handle of the timer
+     */
+    TimerHandle scheduleEvery(uint64_t intervalUs, void (*func)(void*), void* data);
+
+    /**
+     * @brief cancel a timer
+     * 
+     * A callback that already started is not interrupted. With a thread pool, a periodic callback may still run once.
+     * 
+     * @param handle the handle of the timer to cancel
+     * @return true : the timer was cancelled
+     * @return false : the timer already expired or was cancelled before
+     */
+    bool cancel(TimerHandle handle);
+
+    /**
+     * @brief get the amount of timers that did not expire yet
+     * 
+     * @return uint64_t the amount of pending timers
+     */
+    uint64_t pendingCount();
+
+    /**
+     * @brief get the current time of the wheel's clock
+     * 
+     * @return uint64_t the microseconds since the wheel was created
+     */
+    inline uint64_t now() const noexcept
+    {return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_start).count();}
+
+protected:
+
+    /**
+     * @brief the function of the service thread
+     * 
+     * @param wheel a pointer to the timer wheel
+     */
+    static void serviceMain(void* wheel);
+
+    /**
+     * @brief add a timer to the slot that matches its deadline. The mutex must be locked.
+     * 
+     * @param index the index of the timer
+     */
+    void insert(uint32_t index) noexcept;
+
+    /**
+     * @brief remove a timer from its slot. The mutex must be locked.
+     * 
+     * @param index the index of the timer
+     */
+    void unlink(uint32_t index) noexcept;
+
+    /**
+     * @brief create a new timer. The mutex must be locked.
+     * 
+     * @param expires the tick the timer expires at
+     * @param interval the interval in ticks or 0 for a single execution
+     * @param func the function to call
+     * @param data the data to pass to the function
+     * @return TimerHandle the handle of the timer
+     */
+    TimerHandle create(uint64_t expires, uint64_t interval, void (*func)(void*), void* data);
+
+    /**
+     * @brief free a timer. The mutex must be locked.
+     * 
+     * @param index the index of the timer
+     */
+    void release(uint32_t index) noexcept;
+
+    /**
+     * @brief process the next tick and collect the expired callbacks. The mutex must be locked.
+     */
+    void processTick();
+
+    /**
+     * @brief get the tick a point in time falls into, rounded up
+     * 
+     * @param timeUs the point in time in microseconds of the wheel's clock
+     * @return uint64_t the tick
+     */
+    inline uint64_t tickOf(uint64_t timeUs) const noexcept {return (timeUs + m_resolution - 1) / m_resolution;}
+
+    /**
+     * @brief the point in time the wheel's clock starts at
+     */
+    std::chrono::steady_clock::time_point m_start;
+    /**
+     * @brief the length of a tick in microseconds
+     */
+    uint64_t m_resolution;
+    /**
+     * @brief the pool to execute the callbacks on or NULL
+     */
+    s_ThreadPool* m_pool;
+    /**
+     * @brief the next tick to process
+     */
+    uint64_t m_tick = 0;
+    /**
+     * @brief the first timer of each slot or UINT32_MAX
+     */
+    uint32_t m_slots[GLGE_TIMER_WHEEL_LEVELS * GLGE_TIMER_WHEEL_SLOTS];
+    /**
+     * @brief the storage of all timers
+     */
+    std::vector<TimerWheelNode> m_nodes;
+    /**
+     * @brief the first unused timer or UINT32_MAX
+     */
+    uint32_t m_free = UINT32_MAX;
+    /**
+     * @brief the amount of pending timers
+     */
+    uint64_t m_count = 0;
+    /**
+     * @brief the callbacks that expired in the current step of the service thread
+     */
+    std::vector<ThreadPoolTask> m_due;
+    /**
+     * @brief protects the whole wheel
+     */
+    std::mutex m_mutex;
+    /**
+     * @brief wakes the service thread
+     */
+    std::condition_variable m_cond;
+    /**
+     * @brief true if the service thread should stop
+     */
+    bool m_stop = false;
+    /**
+     * @brief the service thread
+     */
+    Thread* m_thread = nullptr;
+
+    #else
+
+    //for windows, add a single byte here to make the struct contain something
+    uint8_t byte;
+
+    #endif
+
+    //for C, this is an opaque structure
+
+} TimerWheel;
+
+//start an extern section for C
+//just to be sure
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief create a new timer wheel and start its service thread
+ * 
+ * @param pool the thread pool to execute the callbacks on or NULL to execute them on the service thread
+ * @param resolutionUs the length of a single tick in microseconds. 0 means 1000.
+ * @return TimerWheel* a pointer to the new timer wheel
+ */
+TimerWheel* timerWheel_Create(ThreadPool* pool, uint64_t resolutionUs);
+
+/**
+ * @brief destroy a timer wheel. Timers that did not expire yet are dropped without calling them.
+ * 
+ * @param wheel a pointer to the timer wheel to destroy
+ */
+void timerWheel_Destroy(TimerWheel* wheel);
+
+/**
+ * @brief execute a callback once a point in time is reached
+ * 
+ * @param deadlineUs the point in time in microseconds of the wheel's clock (see timerWheel_Now)
+ * @param func the function to call
+ * @param data the data to pass to the function
+ * @param wheel a pointer to the timer wheel
+ * @return TimerHandle the handle of the timer
+ */
+TimerHandle timerWheel_ScheduleAt(uint64_t deadlineUs, void (*func)(void*), void* data, TimerWheel* wheel);
+
+/**
+ * @brief execute a callback once after a delay
+ * 
+ * @param delayUs the delay in microseconds
+ * @param func the function to call
+ * @param data the data to pass to the function
+ * @param wheel a pointer to the timer wheel
+ * @return TimerHandle the handle of the timer
+ */
+TimerHandle timerWheel_ScheduleAfter(uint64_t delayUs, void (*func)(void*), void* data, TimerWheel* wheel);
+
+/**
+ * @brief execute a callback periodically till the timer is cancelled
+ * 
+ * @param intervalUs the time between two executions in microseconds
+ * @param func the function to call
+ * @param data the data to pass to the function
+ * @param wheel a pointer to the timer wheel
+ * @return TimerHandle the handle of the timer
+ */
+TimerHandle timerWheel_ScheduleEvery(uint64_t intervalUs, void (*func)(void*), void* data, TimerWheel* wheel);
+
+/**
+ * @brief cancel a timer
+ * 
+ * @param handle the handle of the timer to cancel
+ * @param wheel a pointer to the timer wheel the timer belongs to
+ * @return true : the timer was cancelled
+ * @return false : the timer already expired or was cancelled before
+ */
+bool timerWheel_Cancel(TimerHandle handle, TimerWheel* wheel);
+
+/**
+ * @brief get the amount of timers that did not expire yet
+ * 
+ * @param wheel a pointer to the timer wheel to quarry
+ * @return uint64_t the amount of pending timers
+ */
+uint64_t timerWheel_PendingCount(TimerWheel* wheel);
+
+/**
+ * @brief get the current time of the wheel's clock
+ * 
+ * @param wheel a pointer to the timer wheel to quarry
+ * @return uint64_t the microseconds since the wheel was created
+ */
+uint64_t timerWheel_Now(const TimerWheel* wheel);
+
+//the the extern section in C++
+#if __cplusplus
+}
+#endif
+
+#endif
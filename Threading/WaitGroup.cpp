@@ -0,0 +1,62 @@
+/**
+ * @file WaitGroup.cpp
+ * @author DM8AT
+ * @brief implement the wait group and its C binding
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the wait group
+#include "WaitGroup.h"
+
+//for the timeout
+#include <chrono>
+
+void s_WaitGroup::done() noexcept
+{
+    //fast path: as long as this is not the last work item, a plain decrement is enough
+    uint64_t count = m_count.load(std::memory_order_relaxed);
+    while (count > 1)
+    {
+        if (m_count.compare_exchange_weak(count, count - 1, std::memory_order_acq_rel, std::memory_order_relaxed)) {return;}
+    }
+    //the last work item is finished while holding the mutex. A waiter can only return after acquiring the
+    //mutex, so the group is never destroyed while it is still used here.
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (m_count.fetch_sub(1, std::memory_order_acq_rel) == 1) {m_cond.notify_all();}
+}
+
+void s_WaitGroup::wait() noexcept
+{
+    //sleep till the counter reaches zero
+    //the mutex is always acquired, so done() has fully finished when this returns
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cond.wait(lock, [this]{return isDone();});
+}
+
+bool s_WaitGroup::waitFor(uint64_t microseconds) noexcept
+{
+    //sleep till the counter reaches zero or the time is up
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_cond.wait_for(lock, std::chrono::microseconds(microseconds), [this]{return isDone();});
+}
+
+
+extern "C" {
+
+WaitGroup* waitGroup_Create() {return new WaitGroup();}
+
+void waitGroup_Destroy(WaitGroup* group) {delete group;}
+
+void waitGroup_Add(uint64_t n, WaitGroup* group) {group->add(n);}
+
+void waitGroup_Done(WaitGroup* group) {group->done();}
+
+void waitGroup_Wait(WaitGroup* group) {group->wait();}
+
+bool waitGroup_IsDone(const WaitGroup* group) {return group->isDone();}
+
+}
@@ -0,0 +1,33 @@
+/**
+ * @file LogDecode.cpp
+ * @author DM8AT
+ * @brief a command line tool that prints a binary log file as text
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the logger for the binary log functions and the default print function
+#include "../Debugging/Logging/Logger.h"
+
+//printing stuff
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    //exactly one file is decoded
+    if (argc != 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <binary log file>\n";
+        return 1;
+    }
+
+    if (!binaryLog_Decode(argv[1], logger_defaultPrint))
+    {
+        std::cerr << "Failed to read the binary log file " << argv[1] << "\n";
+        return 1;
+    }
+    return 0;
+}
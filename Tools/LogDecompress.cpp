@@ -0,0 +1,47 @@
+/**
+ * @file LogDecompress.cpp
+ * @author DM8AT
+ * @brief a command line tool that decompresses a log file written by a compressing file sink
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the frame functions
+#include "../Debugging/Logging/LogCompression.h"
+
+//printing stuff
+#include <iostream>
+#include <cstdio>
+
+int main(int argc, char** argv)
+{
+    //decompress to the standard output or to a file
+    if ((argc != 2) && (argc != 3))
+    {
+        std::cerr << "Usage: " << argv[0] << " <compressed log file> [output file]\n";
+        return 1;
+    }
+
+    FILE* out = (argc == 3) ? fopen(argv[2], "wb") : stdout;
+    if (!out)
+    {
+        std::cerr << "Failed to create the output file " << argv[2] << "\n";
+        return 1;
+    }
+
+    bool valid = logCompression_DecompressFile(argv[1], [](const char* data, uint64_t size, void* file) {
+        fwrite(data, 1, (size_t)size, (FILE*)file);
+    }, out);
+    if (out != stdout) {fclose(out);}
+    else {fflush(out);}
+
+    if (!valid)
+    {
+        std::cerr << "Failed to decompress the log file " << argv[1] << "\n";
+        return 1;
+    }
+    return 0;
+}